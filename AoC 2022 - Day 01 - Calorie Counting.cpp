@@ -1,187 +1,398 @@
-// AoC 2022 - day 01 - Calorie Counting
-// ====================================
-
-// date:  2022-12-01
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0,
-    TEST,
-    PUZZLE
-} glbProgPhase;
-
-// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-//typedef vector<int>       DatumType;
-typedef struct elfStruct {       // total calorie value was practical for part 2 (sorting)
-    vector<int> vCalList;
-    int nTotal;
-} DatumType;
-typedef vector<DatumType> DataStream;
-
-// ==========   DATA INPUT FUNCTIONS
-
-void GetData_EXAMPLE( DataStream &dData ) {
-    DatumType aux;
-
-    aux.vCalList.clear();
-    aux.vCalList.push_back(1000);
-    aux.vCalList.push_back(2000);
-    aux.vCalList.push_back(3000);
-    dData.push_back( aux );
-
-    aux.vCalList.clear();
-    aux.vCalList.push_back(4000 );
-    dData.push_back( aux );
-
-    aux.vCalList.clear();
-    aux.vCalList.push_back(5000 );
-    aux.vCalList.push_back(6000 );
-    dData.push_back( aux );
-
-    aux.vCalList.clear();
-    aux.vCalList.push_back(7000 );
-    aux.vCalList.push_back(8000 );
-    aux.vCalList.push_back(9000 );
-    dData.push_back( aux );
-
-    aux.vCalList.clear();
-    aux.vCalList.push_back(10000 );
-    dData.push_back( aux );
-}
-
-// this function assumes 1 line to contain 1 token
-void ReadInputData( const string sFileName, DataStream &vData ) {
-
-    ifstream dataFileStream( sFileName );
-    vData.clear();
-    string token;
-    DatumType datum;
-
-    while (getline( dataFileStream, token )) {
-        if (token.length() == 0) { // empty line
-            vData.push_back( datum );
-            datum.vCalList.clear();
-        } else {
-            int nVal = atoi( token.c_str() );
-            datum.vCalList.push_back( nVal );
-        }
-    }
-    if (datum.vCalList.size() > 0)
-        vData.push_back( datum );
-
-    dataFileStream.close();
-}
-
-void GetData_TEST(   DataStream &dData ) { ReadInputData( "input.test.txt", dData ); }
-void GetData_PUZZLE( DataStream &dData ) { ReadInputData( "input.puzzle.txt", dData ); }
-
-// ==========   OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    for (auto e : iData.vCalList) {
-        cout << e << endl;
-    }
-    cout << endl;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (auto &e : dData) {
-        PrintDatum( e );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST:    GetData_TEST(    dData ); break;
-        case PUZZLE:  GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> program phase not recognized: " << glbProgPhase;
-    }
-
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-// none here - it's all implemented in main
-
-// ==========   MAIN()
-
-int main()
-{
-    glbProgPhase = PUZZLE;     // program phase to EXAMPLE, TEST or PUZZLE
-
-    flcTimer tmr;
-    tmr.StartTiming(); // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream elfData;
-    GetInput( elfData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << elfData.size() << endl << endl;
-
-    tmr.TimeReport( "Timing data input: " );   // ====================^^^^^vvvvv
-
-// ========== part 1
-
-    // for all elves in the list, accumulate the calorie weight in it's nTotal field
-    // at the same time, select the max calorie weight from the list
-    int maxNrCalories = -1;
-    int elfIndex = -1;
-    for (int i = 0; i < (int)elfData.size(); i++) {
-        int sum = 0;
-        for (int j = 0; j < (int)elfData[i].vCalList.size(); j++) {
-            sum += elfData[i].vCalList[j];
-        }
-        elfData[i].nTotal = sum;
-        if (sum > maxNrCalories) {
-            maxNrCalories = sum;
-            elfIndex = i;
-        }
-    }
-    cout << endl << "Answer 1 - elf: " << elfIndex << " carries most calories, being: " << maxNrCalories << endl << endl;
-
-    tmr.TimeReport( "Timing 1: " );   // ==============================^^^^^
-
-// ========== part 2
-
-    // sort the list of elves in decreasing order of accumulated calorie weight
-    sort( elfData.begin(), elfData.end(),
-        []( DatumType d1, DatumType d2 ) {
-            return d1.nTotal > d2.nTotal;
-        }
-    );
-    // calc. and report the weight of the three heaviest elves
-    int nAnswer2 = 0; for (int i = 0; i < 3; i++) nAnswer2 += elfData[i].nTotal;
-    cout << endl << "Answer 2 - total nr of calories for heaviest three elves: " << nAnswer2 << endl << endl;
-
-    tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
-
-
-
-
-
+// AoC 2022 - day 01 - Calorie Counting
+// ====================================
+
+// date:  2022-12-01
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcTokenizer.h"
+#include "../flcSimdText.h"
+#include "../flcStreamReader.h"
+#include "../flcPipeline.h"
+#include "../flcInputCache.h"
+#include "../flcTopK.h"
+#include "../flcParallel.h"
+
+using namespace std;
+
+namespace day01 {
+
+// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+// All elves in one compressed (CSR) layout, instead of a vector per elf: the calorie values of all
+// elves are in one array, and the values of elf i are vCalories[ vOffsets[i] ] up to vCalories[ vOffsets[i + 1] ].
+// The total per elf and the three highest totals are computed while parsing, both parts only need those.
+typedef struct sElfDataStruct {
+    vector<int>       vCalories;
+    vector<size_t>    vOffsets = { 0 };    // one more than the nr of elves
+    vector<long long> vTotals;
+    vector<long long> vTopTotals;          // the three highest totals, largest first
+
+    size_t NrElves() const { return vTotals.size(); }
+    void Clear() { vCalories.clear(); vOffsets.assign( 1, 0 ); vTotals.clear(); vTopTotals.clear(); }
+    // the values from the last offset to the end of vCalories form a new elf, with total nTotal
+    void CloseElf( long long nTotal ) {
+        vOffsets.push_back( vCalories.size());
+        vTotals.push_back( nTotal );
+    }
+    void CloseElf() {
+        long long nTotal = 0;
+        for (size_t i = vOffsets.back(); i < vCalories.size(); i++) {
+            nTotal += vCalories[i];
+        }
+        CloseElf( nTotal );
+    }
+    // selects the top totals from all totals - for when they are not known from parsing
+    void SelectTopTotals() {
+        flcTopK<long long> topElves( 3 );
+        topElves.Add( vTotals.begin(), vTotals.end());
+        vTopTotals = topElves.Sorted();
+    }
+} DataStream;
+
+// A chunk of the input (see ParseCalories()) can start and end in the middle of an elf: the values before
+// its first empty line (the head) belong to the last elf of the previous chunk, and the values after its
+// last empty line (the tail) to the first elf of the next chunk. The head is elf 0 of the chunk's own data
+// (if the chunk has an empty line at all), the tail is not closed.
+typedef struct sChunkStruct {
+    DataStream         dData;
+    long long          nTailTotal = 0;
+    flcTopK<long long> topElves{ 3 };    // over the elves after the head, which are complete within the chunk
+} ChunkType;
+
+// for the input cache (see flcInputCache.h)
+void flcCacheWrite( flcCacheWriter &w, const DataStream &d ) { w.Put( d.vCalories ); w.Put( d.vOffsets ); w.Put( d.vTotals ); }
+bool flcCacheRead(  flcCacheReader &r,       DataStream &d ) {
+    bool bValid = r.Get( d.vCalories ) && r.Get( d.vOffsets ) && r.Get( d.vTotals ) &&
+           d.vOffsets.size() == d.vTotals.size() + 1 && d.vOffsets.front() == 0 && d.vOffsets.back() == d.vCalories.size();
+    if (bValid) {
+        d.SelectTopTotals();
+    }
+    return bValid;
+}
+
+// ==========   DATA INPUT FUNCTIONS
+
+void AddElf_EXAMPLE( DataStream &dData, const vector<int> &vCalList ) {
+    dData.vCalories.insert( dData.vCalories.end(), vCalList.begin(), vCalList.end());
+    dData.CloseElf();
+}
+
+void GetData_EXAMPLE( DataStream &dData ) {
+    dData.Clear();
+    AddElf_EXAMPLE( dData, { 1000, 2000, 3000 } );
+    AddElf_EXAMPLE( dData, { 4000 } );
+    AddElf_EXAMPLE( dData, { 5000, 6000 } );
+    AddElf_EXAMPLE( dData, { 7000, 8000, 9000 } );
+    AddElf_EXAMPLE( dData, { 10000 } );
+    dData.SelectTopTotals();
+}
+
+// Parses one chunk of the raw input in one pass, without an index of the lines: a SIMD compare finds the
+// line terminators of a whole block at a time (see flcSimdText.h), the numbers are converted with
+// flcParse8Digits(), and the total of the current elf is kept in a register.
+// Each line contains 1 number. An empty line closes an elf (even if it has no values).
+void ParseChunk( string_view sRaw, ChunkType &chunk ) {
+    const char *pData = sRaw.data();
+    size_t nSize = sRaw.size();
+    DataStream &dData = chunk.dData;
+    dData.Clear();
+    dData.vCalories.reserve( nSize / 8 );
+
+    long long nTotal = 0;
+    size_t nLineStart = 0;
+    // handles the line from nLineStart up to nEnd (the position of its '\n', or the end of the input)
+    auto handle_line = [&]( size_t nEnd ) {
+        size_t nLength = nEnd - nLineStart;
+        if (nLength > 0 && pData[nEnd - 1] == '\r') {
+            nLength -= 1;
+        }
+        if (nLength == 0) {    // empty line
+            dData.CloseElf( nTotal );
+            nTotal = 0;
+        } else {
+            // the fast conversion reads 8 bytes, so not too close to the end of the input
+            unsigned int nValue;
+            int nCalories = (nLineStart + 8 <= nSize && flcParse8Digits( pData + nLineStart, (int)nLength, nValue ))
+                                ? (int)nValue : flcToNumber<int>( string_view( pData + nLineStart, nLength ));
+            dData.vCalories.push_back( nCalories );
+            nTotal += nCalories;
+        }
+        nLineStart = nEnd + 1;
+    };
+
+    size_t i = 0;
+    for (; i + FLC_TEXT_BLOCK <= nSize; i += FLC_TEXT_BLOCK) {
+        for (unsigned int nMask = flcByteMask( pData + i, '\n' ); nMask != 0; nMask &= nMask - 1) {
+            handle_line( i + flcLowestBit( nMask ));
+        }
+    }
+    // the last part (less than a block) byte by byte
+    for (; i < nSize; i++) {
+        if (pData[i] == '\n') {
+            handle_line( i );
+        }
+    }
+    // a last line without terminator, and the last elf
+    if (nLineStart < nSize) {
+        handle_line( nSize );
+    }
+    chunk.nTailTotal = nTotal;
+    if (dData.NrElves() > 1) {
+        chunk.topElves.Add( dData.vTotals.begin() + 1, dData.vTotals.end());
+    }
+}
+
+// Parses the raw contents of the input file in parallel: it's cut in one chunk per thread (of at least
+// 1 MB), and each chunk is parsed into its own data. Then the chunks are stitched together in order: the
+// tails of the chunks without an empty line and the head of the next chunk with one make up one elf.
+// The three highest totals are selected from the top 3 of each chunk and the stitched elves.
+// At the end of the input the last elf is only closed if it has any values.
+void ParseCalories( string_view sRaw, DataStream &dData ) {
+    vector<string_view> vPieces = flcSplitLines( sRaw, (int)clamp<size_t>( sRaw.size() >> 20, 1, flcScheduler::NrThreads()));
+    vector<ChunkType> vChunks( vPieces.size());
+    flcParallelFor( 0, vPieces.size(), 1, [&]( long long nFrom, long long nTo ) {
+            for (long long c = nFrom; c < nTo; c++) {
+                ParseChunk( vPieces[c], vChunks[c] );
+            }
+        }
+    );
+
+    // where the values and elves of each chunk go, and the total of the open elf at the start of each chunk
+    size_t nChunks = vChunks.size();
+    vector<size_t>    vValueBase( nChunks + 1, 0 ), vElfBase( nChunks + 1, 0 );
+    vector<long long> vCarry( nChunks + 1, 0 );
+    for (size_t c = 0; c < nChunks; c++) {
+        const DataStream &d = vChunks[c].dData;
+        vValueBase[c + 1] = vValueBase[c] + d.vCalories.size();
+        vElfBase[c + 1]   = vElfBase[c] + d.NrElves();
+        vCarry[c + 1]     = (d.NrElves() > 0 ? 0 : vCarry[c]) + vChunks[c].nTailTotal;
+    }
+
+    // a single chunk (one thread, or a small input) is the result as it is
+    if (nChunks == 1) {
+        dData = move( vChunks[0].dData );
+    } else {
+        dData.Clear();
+        dData.vCalories.resize( vValueBase[nChunks] );
+        dData.vOffsets.resize( vElfBase[nChunks] + 1 );
+        dData.vTotals.resize( vElfBase[nChunks] );
+        flcParallelFor( 0, nChunks, 1, [&]( long long nFrom, long long nTo ) {
+                for (long long c = nFrom; c < nTo; c++) {
+                    const DataStream &d = vChunks[c].dData;
+                    copy( d.vCalories.begin(), d.vCalories.end(), dData.vCalories.begin() + vValueBase[c] );
+                    for (size_t i = 0; i < d.NrElves(); i++) {
+                        dData.vOffsets[vElfBase[c] + i + 1] = vValueBase[c] + d.vOffsets[i + 1];
+                        dData.vTotals[ vElfBase[c] + i    ] = d.vTotals[i];
+                    }
+                    // the head completes the elf that is open at the start of the chunk
+                    if (d.NrElves() > 0) {
+                        dData.vTotals[vElfBase[c]] += vCarry[c];
+                    }
+                }
+            }
+        );
+    }
+    if (dData.vCalories.size() > dData.vOffsets.back()) {
+        dData.CloseElf( vCarry[nChunks] );
+    }
+
+    flcTopK<long long> topElves( 3 );
+    for (size_t c = 0; c < nChunks; c++) {
+        vector<long long> vTop = vChunks[c].topElves.Sorted();
+        topElves.Add( vTop.begin(), vTop.end());
+        if (vElfBase[c + 1] > vElfBase[c]) {    // the stitched head
+            topElves.Add( dData.vTotals[vElfBase[c]] );
+        }
+    }
+    if (dData.NrElves() > vElfBase[nChunks]) {
+        topElves.Add( dData.vTotals.back());
+    }
+    dData.vTopTotals = topElves.Sorted();
+}
+
+void ReadInputData( const string sFileName, DataStream &vData ) {
+    flcInputFile inputFile( sFileName, false );
+    ParseCalories( inputFile.Contents(), vData );
+}
+
+// input generator - writes nSize calorie lines, in groups (elves) of 1 to 10 items that are
+// separated by an empty line
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    long long nInGroup = 0, nGroupSize = rng.Range( 1, 10 );
+    for (long long i = 0; i < nSize; i++) {
+        if (nInGroup == nGroupSize) {
+            os << "\n";
+            nInGroup = 0;
+            nGroupSize = rng.Range( 1, 10 );
+        }
+        os << rng.Range( 1000, 60000 ) << "\n";
+        nInGroup += 1;
+    }
+}
+
+// ==========   OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( const DataStream &dData, size_t nElf ) {
+    for (size_t i = dData.vOffsets[nElf]; i < dData.vOffsets[nElf + 1]; i++) {
+        cout << dData.vCalories[i] << endl;
+    }
+    cout << endl;
+}
+
+// output to console for testing
+void PrintDataStream( const DataStream &dData ) {
+    for (size_t i = 0; i < dData.NrElves(); i++) {
+        PrintDatum( dData, i );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST:
+        case PUZZLE:  ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> program phase not recognized: " << ePhase;
+    }
+
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+// the answers from the three highest totals: the highest one, and the sum of all three
+void TopAnswers( const flcTopK<long long> &topElves, string &sAnswer1, string &sAnswer2 ) {
+    vector<long long> vTop = topElves.Sorted();
+    long long nSum = 0;
+    for (auto nTotal : vTop) {
+        nSum += nTotal;
+    }
+    sAnswer1 = to_string( vTop.empty() ? 0 : vTop[0] );
+    sAnswer2 = to_string( nSum );
+}
+
+// the sum of the k (at most 3) highest totals
+long long SumOfTopTotals( const DataStream &dData, size_t k ) {
+    long long nSum = 0;
+    for (size_t i = 0; i < k && i < dData.vTopTotals.size(); i++) {
+        nSum += dData.vTopTotals[i];
+    }
+    return nSum;
+}
+
+// ==========   RUNNER INTERFACE
+
+class Day01 : public aocDay {
+public:
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day01::GetInput( elfData, ePhase, sFileName, ePhase != PUZZLE );
+    }
+    size_t DataSize() { return elfData.NrElves(); }
+    // nSize is the nr of calorie lines
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( elfData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { ePhase = eRunPhase; return reader.GetAll( elfData ); }
+
+// ========== part 1
+
+    // the top totals are selected while parsing (in parallel, see ParseCalories()), so both parts just add them
+    string SolvePart1() {
+        return to_string( SumOfTopTotals( elfData, 1 ));
+    }
+
+// ========== part 2
+
+    string SolvePart2() {
+        // calc. and report the weight of the three heaviest elves
+        return to_string( SumOfTopTotals( elfData, 3 ));
+    }
+
+// ========== streaming - both parts in one pass
+
+    // only the total of the current elf and the three highest totals so far are kept
+    bool SolveStreaming( flcStreamReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        flcTopK<long long> topElves( 3 );
+        long long nCurTotal = 0;
+        bool bInElf = false;
+
+        auto finish_elf = [&]() {
+            if (bInElf) {
+                topElves.Add( nCurTotal );
+            }
+            nCurTotal = 0;
+            bInElf = false;
+        };
+
+        string_view sLine;
+        while (reader.NextLine( sLine )) {
+            if (sLine.length() == 0) {    // empty line
+                finish_elf();
+            } else {
+                nCurTotal += flcToNumber<int>( sLine );
+                bInElf = true;
+            }
+        }
+        finish_elf();
+
+        TopAnswers( topElves, sAnswer1, sAnswer2 );
+        return true;
+    }
+
+// ========== pipelined - both parts as a fold over the calorie lines
+
+    // the records are the calorie values, an empty line (the end of an elf) is passed as -1
+    bool SolvePipelined( eProgPhase eRunPhase, flcBlockReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        flcTopK<long long> topElves( 3 );
+        long long nCurTotal = 0;
+        bool bInElf = false;
+
+        auto finish_elf = [&]() {
+            if (bInElf) {
+                topElves.Add( nCurTotal );
+            }
+            nCurTotal = 0;
+            bInElf = false;
+        };
+
+        flcRunPipeline<int>( reader,
+            []( string_view sLine, int &nCalories ) {
+                nCalories = (sLine.length() == 0) ? -1 : flcToNumber<int>( sLine );
+                return true;
+            },
+            [&]( int nCalories ) {
+                if (nCalories < 0) {
+                    finish_elf();
+                } else {
+                    nCurTotal += nCalories;
+                    bInElf = true;
+                }
+            }
+        );
+        finish_elf();
+
+        TopAnswers( topElves, sAnswer1, sAnswer2 );
+        return true;
+    }
+
+private:
+    DataStream elfData;
+};
+
+aocRegistrar registrar( 1, "Calorie Counting", aocCreateDay<Day01> );
+
+} // namespace day01
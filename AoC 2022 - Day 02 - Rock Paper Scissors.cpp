@@ -1,236 +1,413 @@
-// AoC 2022 - day 02 - Rock Paper Scissors
-// =======================================
-
-// date:  2022-12-02
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0,
-    TEST,
-    PUZZLE
-} glbProgPhase;
-
-// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-#define F_ROCK 'A'   // first select, 'A' is interpreted as rock, etc
-#define F_PAPR 'B'
-#define F_SCRS 'C'
-
-#define S_ROCK 'X'   // second select, 'X' is interpreted as rock, etc
-#define S_PAPR 'Y'
-#define S_SCRS 'Z'
-
-#define S_LOSE 'X'   // second alternative select interpretation, 'X' is interpreted as must lose, etc
-#define S_DRAW 'Y'
-#define S_WIN  'Z'
-
-// the data consists of 'turns' having a first and second selection
-typedef struct datumStruct {
-    char f, s;
-} DatumType;
-typedef vector<DatumType> DataStream;
-
-// ==========   DATA INPUT FUNCTIONS
-
-void GetData_EXAMPLE( DataStream &dData ) {
-    DatumType aux;
-
-    aux.f = 'A'; aux.s = 'Y'; dData.push_back( aux );
-    aux.f = 'B'; aux.s = 'X'; dData.push_back( aux );
-    aux.f = 'C'; aux.s = 'Z'; dData.push_back( aux );
-}
-
-// this function assumes each non empty line to contain 1 char on position 0, and 1 char on position 2
-void ReadInputData( const string sFileName, DataStream &vData ) {
-
-    ifstream dataFileStream( sFileName );
-    vData.clear();
-    string token;
-    DatumType datum;
-
-    while (getline( dataFileStream, token )) {
-        if (token.length() > 0) {    // non empty line
-            datum.f = token[0];
-            datum.s = token[2];
-            vData.push_back( datum );
-        }
-    }
-    dataFileStream.close();
-}
-
-void GetData_TEST(   DataStream &dData ) { ReadInputData( "input.test.txt", dData ); }
-void GetData_PUZZLE( DataStream &dData ) { ReadInputData( "input.puzzle.txt", dData ); }
-
-// ==========   OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    cout << iData.f << " " << iData.s << endl;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (auto &e : dData) {
-        PrintDatum( e );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST:    GetData_TEST(    dData ); break;
-        case PUZZLE:  GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> program phase not recognized: " << glbProgPhase << endl;
-    }
-
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-// determines and returns points if player loses (0 points), wins (6 points) or its a draw (3 points)
-int OutcomeScore( char fst, char scd ) {
-    int result = -1;
-    switch (fst) {
-        case F_ROCK:
-            switch (scd) {
-                case S_ROCK: result = 3; break;  // draw
-                case S_PAPR: result = 6; break;  // win
-                case S_SCRS: result = 0; break;  // lost
-            }
-            break;
-        case F_PAPR:
-            switch (scd) {
-                case S_ROCK: result = 0; break;
-                case S_PAPR: result = 3; break;
-                case S_SCRS: result = 6; break;
-            }
-            break;
-        case F_SCRS:
-            switch (scd) {
-                case S_ROCK: result = 6; break;
-                case S_PAPR: result = 0; break;
-                case S_SCRS: result = 3; break;
-            }
-            break;
-    }
-    return result;
-}
-
-// put score to chosen player form (rock = 1, paper = 2, scissors = 3)
-int SelectionScore( char scd ) {
-    int result = -1;
-    switch (scd) {
-        case S_ROCK: result = 1; break;
-        case S_PAPR: result = 2; break;
-        case S_SCRS: result = 3; break;
-    }
-    return result;
-}
-
-// determines which form to chose to get desired outcome if elf choses form fst
-char SelectSecond( char fst, char outcome ) {
-    char result = ' ';
-    switch (fst) {
-        case F_ROCK:
-            switch (outcome) {
-                case S_LOSE: result = S_SCRS; break;
-                case S_DRAW: result = S_ROCK; break;
-                case S_WIN : result = S_PAPR; break;
-            }
-            break;
-        case F_PAPR:
-            switch (outcome) {
-                case S_LOSE: result = S_ROCK; break;
-                case S_DRAW: result = S_PAPR; break;
-                case S_WIN : result = S_SCRS; break;
-            }
-            break;
-        case F_SCRS:
-            switch (outcome) {
-                case S_LOSE: result = S_PAPR; break;
-                case S_DRAW: result = S_SCRS; break;
-                case S_WIN : result = S_ROCK; break;
-            }
-            break;
-    }
-    return result;
-}
-
-// for part 1 - score calculation for 1 turn: just assign score for selection and for the outcome
-int TotalScore1( char fst, char scd ) {
-    return SelectionScore( scd ) + OutcomeScore( fst, scd );
-}
-
-// for part 2 - score calculation for 1 turn: first determine the selection from the
-// first selection and the desired outcome then assign points based on that selection and outcome
-int TotalScore2( char fst, char outcome ) {
-    char newSelect = SelectSecond( fst, outcome );
-    return SelectionScore( newSelect ) + OutcomeScore( fst, newSelect );
-}
-
-// ==========   MAIN()
-
-int main()
-{
-    glbProgPhase = PUZZLE;     // program phase to EXAMPLE, TEST or PUZZLE
-
-    flcTimer tmr;
-    tmr.StartTiming(); // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream turnData;
-    GetInput( turnData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << turnData.size() << endl << endl;
-
-    tmr.TimeReport( "Timing data input: " );   // ====================^^^^^vvvvv
-
-// ========== part 1
-
-    int nAccumulateScore = 0;
-    for (auto elt : turnData ) {
-//        PrintDatum( elt );
-        int nLocalScore = TotalScore1( elt.f, elt.s );
-//        cout << "Local score: " << nLocalScore << endl;
-        nAccumulateScore += nLocalScore;
-    }
-
-    cout << endl << "Answer 1 - accumulated score: " << nAccumulateScore << endl << endl;
-
-    tmr.TimeReport( "Timing 1: " );   // ==============================^^^^^
-
-// ========== part 2
-
-    nAccumulateScore = 0;
-    for (auto elt : turnData ) {
-//        PrintDatum( elt );
-        int nLocalScore = TotalScore2( elt.f, elt.s );
-//        cout << "Local score: " << nLocalScore << endl;
-        nAccumulateScore += nLocalScore;
-    }
-
-    cout << endl << "Answer 2 - accumulated score: " << nAccumulateScore << endl << endl;
-
-    tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
+// AoC 2022 - day 02 - Rock Paper Scissors
+// =======================================
+
+// date:  2022-12-02
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcSimdText.h"
+#include "../flcStreamReader.h"
+#include "../flcPipeline.h"
+#include "../flcInputCache.h"
+
+using namespace std;
+
+namespace day02 {
+
+// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+#define F_ROCK 'A'   // first select, 'A' is interpreted as rock, etc
+#define F_PAPR 'B'
+#define F_SCRS 'C'
+
+#define S_ROCK 'X'   // second select, 'X' is interpreted as rock, etc
+#define S_PAPR 'Y'
+#define S_SCRS 'Z'
+
+#define S_LOSE 'X'   // second alternative select interpretation, 'X' is interpreted as must lose, etc
+#define S_DRAW 'Y'
+#define S_WIN  'Z'
+
+// ==========   SCORING RULES
+
+// determines and returns points if player loses (0 points), wins (6 points) or its a draw (3 points)
+int OutcomeScore( char fst, char scd ) {
+    int result = -1;
+    switch (fst) {
+        case F_ROCK:
+            switch (scd) {
+                case S_ROCK: result = 3; break;  // draw
+                case S_PAPR: result = 6; break;  // win
+                case S_SCRS: result = 0; break;  // lost
+            }
+            break;
+        case F_PAPR:
+            switch (scd) {
+                case S_ROCK: result = 0; break;
+                case S_PAPR: result = 3; break;
+                case S_SCRS: result = 6; break;
+            }
+            break;
+        case F_SCRS:
+            switch (scd) {
+                case S_ROCK: result = 6; break;
+                case S_PAPR: result = 0; break;
+                case S_SCRS: result = 3; break;
+            }
+            break;
+    }
+    return result;
+}
+
+// put score to chosen player form (rock = 1, paper = 2, scissors = 3)
+int SelectionScore( char scd ) {
+    int result = -1;
+    switch (scd) {
+        case S_ROCK: result = 1; break;
+        case S_PAPR: result = 2; break;
+        case S_SCRS: result = 3; break;
+    }
+    return result;
+}
+
+// determines which form to chose to get desired outcome if elf choses form fst
+char SelectSecond( char fst, char outcome ) {
+    char result = ' ';
+    switch (fst) {
+        case F_ROCK:
+            switch (outcome) {
+                case S_LOSE: result = S_SCRS; break;
+                case S_DRAW: result = S_ROCK; break;
+                case S_WIN : result = S_PAPR; break;
+            }
+            break;
+        case F_PAPR:
+            switch (outcome) {
+                case S_LOSE: result = S_ROCK; break;
+                case S_DRAW: result = S_PAPR; break;
+                case S_WIN : result = S_SCRS; break;
+            }
+            break;
+        case F_SCRS:
+            switch (outcome) {
+                case S_LOSE: result = S_PAPR; break;
+                case S_DRAW: result = S_SCRS; break;
+                case S_WIN : result = S_ROCK; break;
+            }
+            break;
+    }
+    return result;
+}
+
+// for part 1 - score calculation for 1 turn: just assign score for selection and for the outcome
+int TotalScore1( char fst, char scd ) {
+    return SelectionScore( scd ) + OutcomeScore( fst, scd );
+}
+
+// for part 2 - score calculation for 1 turn: first determine the selection from the
+// first selection and the desired outcome then assign points based on that selection and outcome
+int TotalScore2( char fst, char outcome ) {
+    char newSelect = SelectSecond( fst, outcome );
+    return SelectionScore( newSelect ) + OutcomeScore( fst, newSelect );
+}
+
+// There are only 9 different rounds, so the scores of both parts are computed once for each of them
+// with the functions above, and looked up per round. The table is padded to 16 bytes per part, so
+// that it fits in a SIMD register for a shuffle lookup.
+typedef struct sScoreTableStruct {
+    alignas( 16 ) unsigned char vScore1[16];
+    alignas( 16 ) unsigned char vScore2[16];
+} ScoreTableType;
+
+ScoreTableType MakeScoreTable() {
+    ScoreTableType table = {};
+    for (int f = 0; f < 3; f++) {
+        for (int s = 0; s < 3; s++) {
+            table.vScore1[3 * f + s] = (unsigned char)TotalScore1( F_ROCK + f, S_ROCK + s );
+            table.vScore2[3 * f + s] = (unsigned char)TotalScore2( F_ROCK + f, S_ROCK + s );
+        }
+    }
+    return table;
+}
+
+const ScoreTableType &ScoreTable() {
+    static const ScoreTableType table = MakeScoreTable();
+    return table;
+}
+
+// the index of a round in the score table, or -1 if it's not a valid round
+inline int RoundIndex( char fst, char scd ) {
+    unsigned int f = (unsigned char)(fst - F_ROCK), s = (unsigned char)(scd - S_ROCK);
+    return (f < 3 && s < 3) ? int( 3 * f + s ) : -1;
+}
+
+// ==========   ROUND DATA
+
+// the data consists of the rounds (each as its index in the score table), and the total scores for
+// both parts, which are added up while reading
+typedef struct sRoundDataStruct {
+    vector<unsigned char> vRounds;
+    long long nTotal1 = 0, nTotal2 = 0;
+
+    void Clear() { vRounds.clear(); nTotal1 = 0; nTotal2 = 0; }
+    void AddRound( int nIndex ) {
+        vRounds.push_back( (unsigned char)nIndex );
+        nTotal1 += ScoreTable().vScore1[nIndex];
+        nTotal2 += ScoreTable().vScore2[nIndex];
+    }
+} DataStream;
+
+// for the input cache (see flcInputCache.h)
+void flcCacheWrite( flcCacheWriter &w, const DataStream &d ) { w.Put( d.vRounds ); w.Put( d.nTotal1 ); w.Put( d.nTotal2 ); }
+bool flcCacheRead(  flcCacheReader &r,       DataStream &d ) {
+    return r.Get( d.vRounds ) && r.Get( d.nTotal1 ) && r.Get( d.nTotal2 ) &&
+           all_of( d.vRounds.begin(), d.vRounds.end(), []( unsigned char nIndex ) { return nIndex < 9; } );
+}
+
+// ==========   DATA INPUT FUNCTIONS
+
+void GetData_EXAMPLE( DataStream &dData ) {
+    dData.Clear();
+    dData.AddRound( RoundIndex( 'A', 'Y' ));
+    dData.AddRound( RoundIndex( 'B', 'X' ));
+    dData.AddRound( RoundIndex( 'C', 'Z' ));
+}
+
+// the index of the round in the 4 bytes at p if they have the exact form "X Y\n", otherwise -1
+inline int RecordIndex( const char *p ) {
+    return (p[1] == ' ' && p[3] == '\n') ? RoundIndex( p[0], p[2] ) : -1;
+}
+
+#if defined( FLC_TEXT_AVX2 )
+// Scores the 8 records in the 32 bytes at p, if they all have the exact form "X Y\n" - otherwise returns
+// false, without scoring any of them. The records are turned into table indices in the 32 bit lanes,
+// and both scores are looked up with a byte shuffle of the score table. The scores are added up per
+// 8 bytes into the 64 bit lanes of vSum1 and vSum2, and the 8 indices are written to pIndex.
+inline bool ScoreRecords8( const char *p, __m256i vTable1, __m256i vTable2, __m256i &vSum1, __m256i &vSum2, unsigned char *pIndex ) {
+    // subtracting "A X\n" from each record leaves the bytes f, 0, s, 0 with f and s in 0 .. 2 for a valid one
+    __m256i vRec = _mm256_sub_epi8( _mm256_loadu_si256( (const __m256i *)p ), _mm256_set1_epi32( 0x0A582041 ));
+    __m256i vMax = _mm256_set1_epi32( 0x00020002 );
+    if (_mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_max_epu8( vRec, vMax ), vMax )) != -1) {
+        return false;
+    }
+    __m256i vF   = _mm256_and_si256( vRec, _mm256_set1_epi32( 0xFF ));
+    __m256i vIdx = _mm256_add_epi32( _mm256_add_epi32( vF, _mm256_add_epi32( vF, vF )), _mm256_srli_epi32( vRec, 16 ));
+    // the bytes above the index get their high bit set, so the shuffle makes them 0
+    __m256i vLookup = _mm256_or_si256( vIdx, _mm256_set1_epi32( (int)0x80808000 ));
+    __m256i vZero   = _mm256_setzero_si256();
+    vSum1 = _mm256_add_epi64( vSum1, _mm256_sad_epu8( _mm256_shuffle_epi8( vTable1, vLookup ), vZero ));
+    vSum2 = _mm256_add_epi64( vSum2, _mm256_sad_epu8( _mm256_shuffle_epi8( vTable2, vLookup ), vZero ));
+    // the low byte of each lane to the low 8 bytes
+    __m256i vBytes = _mm256_shuffle_epi8( vIdx, _mm256_setr_epi8( 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                  0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 ));
+    vBytes = _mm256_permutevar8x32_epi32( vBytes, _mm256_setr_epi32( 0, 4, 0, 0, 0, 0, 0, 0 ));
+    _mm_storel_epi64( (__m128i *)pIndex, _mm256_castsi256_si128( vBytes ));
+    return true;
+}
+#endif
+
+// Reads the rounds from the raw contents of the input file, and adds up the scores of both parts in the
+// same pass. Nearly all lines are records of exactly 4 bytes "X Y\n", these are handled 8 at a time
+// with AVX2 (if the compiler targets it), or one at a time with a table lookup. Any other line (like
+// with "\r\n", or a last one without terminator) is handled by itself, then the fast loops go on.
+// Each non empty line is assumed to contain 1 char on position 0, and 1 char on position 2.
+void ScoreRounds( string_view sRaw, DataStream &dData ) {
+    const char *pData = sRaw.data();
+    size_t nSize = sRaw.size();
+    dData.Clear();
+    // each round but the last takes at least 4 bytes
+    dData.vRounds.resize( nSize / 4 + 1 );
+    unsigned char *pIndex = dData.vRounds.data();
+    const ScoreTableType &table = ScoreTable();
+    long long nTotal1 = 0, nTotal2 = 0;
+#if defined( FLC_TEXT_AVX2 )
+    __m256i vTable1 = _mm256_broadcastsi128_si256( _mm_load_si128( (const __m128i *)table.vScore1 ));
+    __m256i vTable2 = _mm256_broadcastsi128_si256( _mm_load_si128( (const __m128i *)table.vScore2 ));
+    __m256i vSum1 = _mm256_setzero_si256(), vSum2 = _mm256_setzero_si256();
+#endif
+
+    size_t i = 0;
+    while (i < nSize) {
+#if defined( FLC_TEXT_AVX2 )
+        for (; i + 32 <= nSize && ScoreRecords8( pData + i, vTable1, vTable2, vSum1, vSum2, pIndex ); i += 32) {
+            pIndex += 8;
+        }
+#endif
+        int nIndex;
+        for (; i + 4 <= nSize && (nIndex = RecordIndex( pData + i )) >= 0; i += 4) {
+            *pIndex++ = (unsigned char)nIndex;
+            nTotal1 += table.vScore1[nIndex];
+            nTotal2 += table.vScore2[nIndex];
+        }
+        if (i < nSize) {
+            // a line that is not a 4 byte record
+            size_t nEol  = sRaw.find( '\n', i );
+            size_t nNext = (nEol == string_view::npos) ? nSize : nEol + 1;
+            string_view sLine = sRaw.substr( i, nNext - i );
+            while (!sLine.empty() && (sLine.back() == '\n' || sLine.back() == '\r')) {
+                sLine.remove_suffix( 1 );
+            }
+            if (sLine.length() > 2) {    // non empty line
+                nIndex = RoundIndex( sLine[0], sLine[2] );
+                if (nIndex < 0) {
+                    cout << "WARNING: ScoreRounds() --> round not recognized: " << sLine << endl;
+                } else {
+                    *pIndex++ = (unsigned char)nIndex;
+                    nTotal1 += table.vScore1[nIndex];
+                    nTotal2 += table.vScore2[nIndex];
+                }
+            }
+            i = nNext;
+        }
+    }
+#if defined( FLC_TEXT_AVX2 )
+    alignas( 32 ) long long vLanes1[4], vLanes2[4];
+    _mm256_store_si256( (__m256i *)vLanes1, vSum1 );
+    _mm256_store_si256( (__m256i *)vLanes2, vSum2 );
+    for (int j = 0; j < 4; j++) {
+        nTotal1 += vLanes1[j];
+        nTotal2 += vLanes2[j];
+    }
+#endif
+    dData.vRounds.resize( pIndex - dData.vRounds.data());
+    dData.nTotal1 = nTotal1;
+    dData.nTotal2 = nTotal2;
+}
+
+void ReadInputData( const string sFileName, DataStream &vData ) {
+    flcInputFile inputFile( sFileName, false );
+    ScoreRounds( inputFile.Contents(), vData );
+}
+
+// input generator - writes nSize rounds of the form "A X"
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    for (long long i = 0; i < nSize; i++) {
+        os << char( 'A' + rng.Range( 0, 2 )) << " " << char( 'X' + rng.Range( 0, 2 )) << "\n";
+    }
+}
+
+// ==========   OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( unsigned char nIndex ) {
+    cout << char( F_ROCK + nIndex / 3 ) << " " << char( S_ROCK + nIndex % 3 ) << endl;
+}
+
+// output to console for testing
+void PrintDataStream( DataStream &dData ) {
+    for (auto e : dData.vRounds) {
+        PrintDatum( e );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST:
+        case PUZZLE:  ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> program phase not recognized: " << ePhase << endl;
+    }
+
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+// the scores of one round for both parts - the record type of the pipelined solver
+typedef struct sScoreStruct {
+    int nScore1, nScore2;
+} ScoreType;
+
+// looks up the scores of one round for both parts, returns false if it's not a valid round
+bool RoundScores( char fst, char scd, ScoreType &score ) {
+    int nIndex = RoundIndex( fst, scd );
+    if (nIndex < 0) {
+        return false;
+    }
+    score = { ScoreTable().vScore1[nIndex], ScoreTable().vScore2[nIndex] };
+    return true;
+}
+
+// ==========   RUNNER INTERFACE
+
+class Day02 : public aocDay {
+public:
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day02::GetInput( turnData, ePhase, sFileName, ePhase != PUZZLE );
+    }
+    size_t DataSize() { return turnData.vRounds.size(); }
+    // nSize is the nr of rounds
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( turnData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { ePhase = eRunPhase; return reader.GetAll( turnData ); }
+
+// ========== part 1
+
+    // the scores of both parts are added up while reading the input (see ScoreRounds())
+    string SolvePart1() {
+        return to_string( turnData.nTotal1 );
+    }
+
+// ========== part 2
+
+    string SolvePart2() {
+        return to_string( turnData.nTotal2 );
+    }
+
+// ========== streaming - both parts in one pass
+
+    bool SolveStreaming( flcStreamReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        long long nAccumulateScore1 = 0, nAccumulateScore2 = 0;
+        string_view sLine;
+        ScoreType score;
+        while (reader.NextLine( sLine )) {
+            if (sLine.length() > 2 && RoundScores( sLine[0], sLine[2], score )) {    // non empty line
+                nAccumulateScore1 += score.nScore1;
+                nAccumulateScore2 += score.nScore2;
+            }
+        }
+        sAnswer1 = to_string( nAccumulateScore1 );
+        sAnswer2 = to_string( nAccumulateScore2 );
+        return true;
+    }
+
+// ========== pipelined - both parts as a fold over the rounds
+
+    // the parser scores the rounds, the records are the scores for both parts
+    bool SolvePipelined( eProgPhase eRunPhase, flcBlockReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        long long nAccumulateScore1 = 0, nAccumulateScore2 = 0;
+        flcRunPipeline<ScoreType>( reader,
+            []( string_view sLine, ScoreType &score ) {
+                return sLine.length() > 2 && RoundScores( sLine[0], sLine[2], score );    // non empty line
+            },
+            [&]( ScoreType score ) {
+                nAccumulateScore1 += score.nScore1;
+                nAccumulateScore2 += score.nScore2;
+            }
+        );
+        sAnswer1 = to_string( nAccumulateScore1 );
+        sAnswer2 = to_string( nAccumulateScore2 );
+        return true;
+    }
+
+private:
+    DataStream turnData;
+};
+
+aocRegistrar registrar( 2, "Rock Paper Scissors", aocCreateDay<Day02> );
+
+} // namespace day02
@@ -1,214 +1,334 @@
-// AoC 2022 - day 03 - Rucksack Reorganization
-// ===========================================
-
-// date:  2022-12-03
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0,
-    TEST,
-    PUZZLE
-} glbProgPhase;
-
-// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-// the data consists of
-//   * org          - original rucksack contents (characters)
-//   * comp1, comp2 - the contents for compartments 1 and 2
-//   * shared       - the one shared item in compartments 1 and 2
-//   * prio         - the prio of that shared item
-typedef struct sDatumType {
-    string org, comp1, comp2;
-    char   shared;
-    int    prio;
-} DatumType;
-typedef vector<DatumType> DataStream;
-
-// ==========   DATA INPUT FUNCTIONS
-
-// hardcoded input - just to get the solution tested
-void GetData_EXAMPLE( DataStream &dData ) {
-    DatumType aux;
-    aux.org.clear(); aux.org.append( "vJrwpWtwJgWrhcsFMMfFFhFp"         ); dData.push_back( aux );
-    aux.org.clear(); aux.org.append( "jqHRNqRjqzjGDLGLrsFMfFZSrLrFZsSL" ); dData.push_back( aux );
-    aux.org.clear(); aux.org.append( "PmmdzqPrVvPwwTWBwg"               ); dData.push_back( aux );
-    aux.org.clear(); aux.org.append( "wMqvLMZHhHMvwLHjbvcjnnSBnvTQFn"   ); dData.push_back( aux );
-    aux.org.clear(); aux.org.append( "ttgJtRGJQctTZtZT"                 ); dData.push_back( aux );
-    aux.org.clear(); aux.org.append( "CrZsJsPPZsGzwwsLwLmpwMDw"         ); dData.push_back( aux );
-}
-
-// file input
-
-// this function assumes each non empty line to contain 1 char on position 0, and 1 on position 2
-void ReadInputData( const string sFileName, DataStream &vData ) {
-
-    ifstream dataFileStream( sFileName );
-    vData.clear();
-    string token;
-    DatumType datum;
-
-    while (getline( dataFileStream, token )) {
-        if (token.length() > 0) {    // non empty line
-            datum.org.clear();
-            datum.org.append( token );
-            vData.push_back( datum );
-        }
-    }
-    dataFileStream.close();
-}
-
-void GetData_TEST(   DataStream &dData ) { ReadInputData( "input.test.txt", dData ); }
-void GetData_PUZZLE( DataStream &dData ) { ReadInputData( "input.puzzle.txt", dData ); }
-
-// ==========   OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    cout << "original: " << iData.org << endl;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (auto &e : dData) {
-        PrintDatum( e );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data, by calling the appropriate input function that is associated
-// with the global program phase var
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST:    GetData_TEST(    dData ); break;
-        case PUZZLE:  GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> program phase not recognized: " << glbProgPhase << endl;
-    }
-
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-int GetPriority( char item ) {
-    int result = -1;
-    if ('a' <= item && item <= 'z') result = item - 'a' +  1;
-    if ('A' <= item && item <= 'Z') result = item - 'A' + 27;
-    return result;
-}
-
-// Cuts of and returns a token of size nSize from the front of input_to_be_adapted.
-// This input string becomes shorter as a result of this cut off, and may even become empty.
-string get_token_sized( const int nSize, string &input_to_be_adapted ) {
-    string token;
-    token = input_to_be_adapted.substr( 0, nSize );
-    input_to_be_adapted = (nSize == (int)string::npos) ? "" : input_to_be_adapted.substr( nSize );
-    return token;
-}
-
-// For part 1 - first split original content string in equal length compartments, then find
-// the shared item in these two compartments and calc the priority of it
-void ProcessRucksack( DatumType &rs ) {
-    // first split the original string up in two equal length compartment
-    string auxOrg = rs.org;
-    int sLen = auxOrg.length();
-    rs.comp1 = get_token_sized( sLen / 2, auxOrg );
-    rs.comp2 = auxOrg;
-    // now find the common item in first and second compartments
-    bool bFound = false;
-    char cCommon = ' ';
-    for (int i = 0; i < (int)rs.comp1.length() && !bFound; i++) {
-        bFound = (rs.comp2.find( rs.comp1[i] ) != string::npos);
-        if (bFound)
-            cCommon = rs.comp1[i];
-    }
-    // check if a shared item was found
-    if (!bFound) {
-        cout << "ERROR: ProcessRucksack() --> Couldn't find shared item..." << endl;
-    } else {
-        rs.shared = cCommon;
-        rs.prio = GetPriority( cCommon );
-    }
-//    cout << "org: " << rs.org << " len: " << sLen << " comp1: " << rs.comp1 << " comp2: " << rs.comp2 << " shared: " << rs.shared << " priority value: " << rs.prio << endl;
-}
-
-// returns true if cBadge occurs in all three elf strings, false otherwise
-bool IsBadge( char cBadge, string &elf1, string &elf2, string &elf3 ) {
-    return (elf1.find( cBadge ) != string::npos) &&
-           (elf2.find( cBadge ) != string::npos) &&
-           (elf3.find( cBadge ) != string::npos);
-}
-
-// returns the one character that is the badge of all three elves
-// (that is contained in all three strings)
-char FindBadge( string &elf1, string &elf2, string &elf3 ) {
-    char cFound = ' ';
-    bool bFound = false;
-    for (char c = 'a'; c <= 'z' && !bFound; c++) {
-        bFound = IsBadge( c, elf1, elf2, elf3 );
-        if (bFound) cFound = c;
-    }
-    for (char c = 'A'; c <= 'Z' && !bFound; c++) {
-        bFound = IsBadge( c, elf1, elf2, elf3 );
-        if (bFound) cFound = c;
-    }
-    return cFound;
-}
-
-// ==========   MAIN()
-
-int main()
-{
-    glbProgPhase = PUZZLE;     // program phase to EXAMPLE, TEST or PUZZLE
-
-    flcTimer tmr;
-    tmr.StartTiming(); // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream sackData;
-    GetInput( sackData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << sackData.size() << endl << endl;
-
-    tmr.TimeReport( "Timing data input: " );   // ====================^^^^^vvvvv
-
-// ========== part 1
-
-    int nCumulatePrios1 = 0;
-    for (auto &elt : sackData) {
-        ProcessRucksack( elt );
-        nCumulatePrios1 += elt.prio;
-    }
-    cout << endl << "Answer 1 - accumulated priorities: " << nCumulatePrios1 << endl << endl;
-
-    tmr.TimeReport( "Timing 1: " );   // ==============================^^^^^
-
-// ========== part 2
-
-    int nCumulatePrios2 = 0;
-    for (int i = 0; i < (int)sackData.size(); i += 3) {
-        char cFound = FindBadge( sackData[i].org, sackData[i + 1].org, sackData[i + 2].org );
-        nCumulatePrios2 += GetPriority( cFound );
-    }
-    cout << endl << "Answer 2 - accumulated priorities: " << nCumulatePrios2 << endl << endl;
-
-    tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
+// AoC 2022 - day 03 - Rucksack Reorganization
+// ===========================================
+
+// date:  2022-12-03
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcTokenizer.h"
+#include "../flcStreamReader.h"
+#include "../flcPipeline.h"
+#include "../flcInputCache.h"
+
+using namespace std;
+
+namespace day03 {
+
+// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+// the data consists of
+//   * org          - original rucksack contents (characters)
+//   * comp1, comp2 - the contents for compartments 1 and 2
+//   * shared       - the one shared item in compartments 1 and 2
+//   * prio         - the prio of that shared item
+typedef struct sDatumType {
+    string org, comp1, comp2;
+    char   shared;
+    int    prio;
+} DatumType;
+typedef vector<DatumType> DataStream;
+
+// for the input cache (see flcInputCache.h)
+void flcCacheWrite( flcCacheWriter &w, const DatumType &d ) { w.Put( d.org ); w.Put( d.comp1 ); w.Put( d.comp2 ); w.Put( d.shared ); w.Put( d.prio ); }
+bool flcCacheRead(  flcCacheReader &r,       DatumType &d ) { return r.Get( d.org ) && r.Get( d.comp1 ) && r.Get( d.comp2 ) && r.Get( d.shared ) && r.Get( d.prio ); }
+
+// ==========   DATA INPUT FUNCTIONS
+
+// hardcoded input - just to get the solution tested
+void GetData_EXAMPLE( DataStream &dData ) {
+    DatumType aux;
+    aux.org.clear(); aux.org.append( "vJrwpWtwJgWrhcsFMMfFFhFp"         ); dData.push_back( aux );
+    aux.org.clear(); aux.org.append( "jqHRNqRjqzjGDLGLrsFMfFZSrLrFZsSL" ); dData.push_back( aux );
+    aux.org.clear(); aux.org.append( "PmmdzqPrVvPwwTWBwg"               ); dData.push_back( aux );
+    aux.org.clear(); aux.org.append( "wMqvLMZHhHMvwLHjbvcjnnSBnvTQFn"   ); dData.push_back( aux );
+    aux.org.clear(); aux.org.append( "ttgJtRGJQctTZtZT"                 ); dData.push_back( aux );
+    aux.org.clear(); aux.org.append( "CrZsJsPPZsGzwwsLwLmpwMDw"         ); dData.push_back( aux );
+}
+
+// file input
+
+// this function assumes each non empty line to contain 1 char on position 0, and 1 on position 2
+void ReadInputData( const string sFileName, DataStream &vData ) {
+
+    flcInputFile inputFile( sFileName );
+    vData.clear();
+    DatumType datum;
+
+    for (auto sLine : inputFile.Lines()) {
+        if (sLine.length() > 0) {    // non empty line
+            datum.org.assign( sLine.data(), sLine.length());
+            vData.push_back( datum );
+        }
+    }
+}
+
+// input generator - writes nSize rucksacks (rounded up to a multiple of 3, for the groups of part 2).
+// Each rucksack has exactly one item type in both compartments, and each group of three rucksacks
+// has exactly one item type (the badge) in common
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    string sTypes = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    for (long long nGroup = 0; nGroup < (nSize + 2) / 3; nGroup++) {
+        rng.Shuffle( sTypes );
+        char cBadge = sTypes[51];
+        for (int r = 0; r < 3; r++) {
+            // each rucksack in the group gets its own 17 item types, plus the badge
+            string sPool = sTypes.substr( r * 17, 17 ) + cBadge;
+            rng.Shuffle( sPool );
+            // the first type goes in both compartments, the others in only one of them
+            string sLeft  = sPool.substr(  1, 9 );
+            string sRight = sPool.substr( 10 );
+            string sComp1( 1, sPool[0] ), sComp2( 1, sPool[0] );
+            // make sure the badge is in the rucksack
+            if (sLeft.find( cBadge ) != string::npos) sComp1.push_back( cBadge );
+            if (sRight.find( cBadge ) != string::npos) sComp2.push_back( cBadge );
+
+            int nHalf = rng.Range( 8, 16 );
+            while ((int)sComp1.length() < nHalf) sComp1.push_back( sLeft[  rng.Range( 0, sLeft.length()  - 1 ) ] );
+            while ((int)sComp2.length() < nHalf) sComp2.push_back( sRight[ rng.Range( 0, sRight.length() - 1 ) ] );
+            rng.Shuffle( sComp1 );
+            rng.Shuffle( sComp2 );
+            os << sComp1 << sComp2 << "\n";
+        }
+    }
+}
+
+// ==========   OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( DatumType &iData ) {
+    cout << "original: " << iData.org << endl;
+}
+
+// output to console for testing
+void PrintDataStream( DataStream &dData ) {
+    for (auto &e : dData) {
+        PrintDatum( e );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data, by calling the appropriate input function that is associated
+// with the global program phase var
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST:
+        case PUZZLE:  ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> program phase not recognized: " << ePhase << endl;
+    }
+
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+int GetPriority( char item ) {
+    int result = -1;
+    if ('a' <= item && item <= 'z') result = item - 'a' +  1;
+    if ('A' <= item && item <= 'Z') result = item - 'A' + 27;
+    return result;
+}
+
+// For part 1 - first split original content string in equal length compartments, then find
+// the shared item in these two compartments and calc the priority of it
+void ProcessRucksack( DatumType &rs ) {
+    // first split the original string up in two equal length compartment
+    flcTokenizer tok( rs.org );
+    rs.comp1 = tok.NextSized( rs.org.length() / 2 );
+    rs.comp2 = tok.Rest();
+    // now find the common item in first and second compartments
+    bool bFound = false;
+    char cCommon = ' ';
+    for (int i = 0; i < (int)rs.comp1.length() && !bFound; i++) {
+        bFound = (rs.comp2.find( rs.comp1[i] ) != string::npos);
+        if (bFound)
+            cCommon = rs.comp1[i];
+    }
+    // check if a shared item was found
+    if (!bFound) {
+        cout << "ERROR: ProcessRucksack() --> Couldn't find shared item..." << endl;
+    } else {
+        rs.shared = cCommon;
+        rs.prio = GetPriority( cCommon );
+    }
+//    cout << "org: " << rs.org << " len: " << sLen << " comp1: " << rs.comp1 << " comp2: " << rs.comp2 << " shared: " << rs.shared << " priority value: " << rs.prio << endl;
+}
+
+// returns true if cBadge occurs in all three elf strings, false otherwise
+bool IsBadge( char cBadge, string &elf1, string &elf2, string &elf3 ) {
+    return (elf1.find( cBadge ) != string::npos) &&
+           (elf2.find( cBadge ) != string::npos) &&
+           (elf3.find( cBadge ) != string::npos);
+}
+
+// returns the one character that is the badge of all three elves
+// (that is contained in all three strings)
+char FindBadge( string &elf1, string &elf2, string &elf3 ) {
+    char cFound = ' ';
+    bool bFound = false;
+    for (char c = 'a'; c <= 'z' && !bFound; c++) {
+        bFound = IsBadge( c, elf1, elf2, elf3 );
+        if (bFound) cFound = c;
+    }
+    for (char c = 'A'; c <= 'Z' && !bFound; c++) {
+        bFound = IsBadge( c, elf1, elf2, elf3 );
+        if (bFound) cFound = c;
+    }
+    return cFound;
+}
+
+// The record type of the pipelined solver: the prio of the shared item (part 1), and the set of item
+// types in the rucksack, as a bit mask with bit p set for the item of priority p (for part 2)
+typedef struct sSackStruct {
+    int                nPrio;
+    unsigned long long nItems;
+} SackType;
+
+unsigned long long ItemMask( string_view sItems ) {
+    unsigned long long nMask = 0;
+    for (char c : sItems) {
+        nMask |= 1ULL << GetPriority( c );
+    }
+    return nMask;
+}
+
+// like ProcessRucksack(), the shared item is the first item of compartment 1 that is in compartment 2
+void ParseSack( string_view sLine, SackType &sack ) {
+    string_view sComp1 = sLine.substr( 0, sLine.length() / 2 );
+    unsigned long long nComp2 = ItemMask( sLine.substr( sLine.length() / 2 ));
+    sack.nPrio  = 0;
+    sack.nItems = ItemMask( sLine );
+    for (int i = 0; i < (int)sComp1.length() && sack.nPrio == 0; i++) {
+        if (nComp2 & (1ULL << GetPriority( sComp1[i] ))) {
+            sack.nPrio = GetPriority( sComp1[i] );
+        }
+    }
+    if (sack.nPrio == 0) {
+        cout << "ERROR: ParseSack() --> Couldn't find shared item..." << endl;
+    }
+}
+
+// like FindBadge(), the badge is the common item with the lowest priority (a - z come before A - Z)
+int BadgePriority( unsigned long long nCommon ) {
+    for (int p = 1; p <= 52; p++) {
+        if (nCommon & (1ULL << p)) {
+            return p;
+        }
+    }
+    return -1;
+}
+
+// ==========   RUNNER INTERFACE
+
+class Day03 : public aocDay {
+public:
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day03::GetInput( sackData, ePhase, sFileName, ePhase != PUZZLE );
+    }
+    size_t DataSize() { return sackData.size(); }
+    // nSize is the nr of rucksacks
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( sackData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { ePhase = eRunPhase; return reader.GetAll( sackData ); }
+
+// ========== part 1
+
+    string SolvePart1() {
+        int nCumulatePrios1 = 0;
+        for (auto &elt : sackData) {
+            ProcessRucksack( elt );
+            nCumulatePrios1 += elt.prio;
+        }
+        return to_string( nCumulatePrios1 );
+    }
+
+// ========== part 2
+
+    string SolvePart2() {
+        int nCumulatePrios2 = 0;
+        for (int i = 0; i + 2 < (int)sackData.size(); i += 3) {
+            char cFound = FindBadge( sackData[i].org, sackData[i + 1].org, sackData[i + 2].org );
+            nCumulatePrios2 += GetPriority( cFound );
+        }
+        return to_string( nCumulatePrios2 );
+    }
+
+// ========== streaming - both parts in one pass
+
+    // only the rucksacks of the current group of three are kept
+    bool SolveStreaming( flcStreamReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        long long nCumulatePrios1 = 0, nCumulatePrios2 = 0;
+        DatumType group[3];
+        int nInGroup = 0;
+
+        string_view sLine;
+        while (reader.NextLine( sLine )) {
+            if (sLine.length() > 0) {    // non empty line
+                DatumType &elt = group[nInGroup];
+                elt.org.assign( sLine.data(), sLine.length());
+                ProcessRucksack( elt );
+                nCumulatePrios1 += elt.prio;
+
+                nInGroup += 1;
+                if (nInGroup == 3) {
+                    char cFound = FindBadge( group[0].org, group[1].org, group[2].org );
+                    nCumulatePrios2 += GetPriority( cFound );
+                    nInGroup = 0;
+                }
+            }
+        }
+        sAnswer1 = to_string( nCumulatePrios1 );
+        sAnswer2 = to_string( nCumulatePrios2 );
+        return true;
+    }
+
+// ========== pipelined - both parts as a fold over the rucksacks
+
+    // the parser does the work per rucksack, the fold only combines the item masks of each group of three
+    bool SolvePipelined( eProgPhase eRunPhase, flcBlockReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        long long nCumulatePrios1 = 0, nCumulatePrios2 = 0;
+        unsigned long long nCommon = 0;
+        int nInGroup = 0;
+
+        flcRunPipeline<SackType>( reader,
+            []( string_view sLine, SackType &sack ) {
+                if (sLine.length() > 0) {    // non empty line
+                    ParseSack( sLine, sack );
+                    return true;
+                }
+                return false;
+            },
+            [&]( SackType sack ) {
+                nCumulatePrios1 += sack.nPrio;
+                nCommon = (nInGroup == 0) ? sack.nItems : (nCommon & sack.nItems);
+                nInGroup += 1;
+                if (nInGroup == 3) {
+                    nCumulatePrios2 += BadgePriority( nCommon );
+                    nInGroup = 0;
+                }
+            }
+        );
+        sAnswer1 = to_string( nCumulatePrios1 );
+        sAnswer2 = to_string( nCumulatePrios2 );
+        return true;
+    }
+
+private:
+    DataStream sackData;
+};
+
+aocRegistrar registrar( 3, "Rucksack Reorganization", aocCreateDay<Day03> );
+
+} // namespace day03
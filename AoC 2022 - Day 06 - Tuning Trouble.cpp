@@ -1,167 +1,215 @@
-// AoC 2022 - day 06 - Tuning Trouble
-// ==================================
-
-// date:  2022-12-06
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0,
-    TEST,
-    PUZZLE
-} glbProgPhase;
-
-// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-// the data consists of 'signals' modeled by characters
-// put them in a vector since I'm unsure of string length boundaries getting in the way
-typedef char DatumType;
-typedef vector<DatumType> DataStream;
-
-// ==========   DATA INPUT FUNCTIONS
-
-// hardcoded input - just to get the solution tested
-void GetData_EXAMPLE( DataStream &dData ) {
-    string auxData = "mjqjpqmgbljsphdztnvjfqwrcgsmlb";     // the puzzle provides multiple examples
-//    string auxData = "bvwbjplbgvbhsrlpgdmjqwftvncz";
-//    string auxData = "nppdvjthqldpwncqszvftbrmjlhg";
-//    string auxData = "nznrnfrfntjfmvfwmzdfjlvtqnbhcprsg";
-//    string auxData = "zcfzfwzzqfrljwzlrfnpqdbhtmscgvjw";
-
-    // convert string to vector of char's
-    for (int i = 0; i < (int)auxData.length(); i++) {
-        dData.push_back( auxData[i] );
-    }
-}
-
-// file input - reads 1 line at a time from .txt file, and process it into vData
-// adapt the parsing and processing of the lines to match the puzzle input
-void ReadInputData( const string sFileName, DataStream &vData ) {
-    ifstream dataFileStream( sFileName );
-    vData.clear();
-    string sLine;
-
-    while (getline( dataFileStream, sLine )) {    // for this particular puzzle I expect only 1 line of data
-        if (sLine.length() > 0) {    // non empty line
-            for (int i = 0; i < (int)sLine.length(); i++) {
-                vData.push_back( sLine[i] );
-            }
-        }
-    }
-    dataFileStream.close();
-}
-
-void GetData_TEST(   DataStream &dData ) { ReadInputData( "input.test.txt", dData ); }
-void GetData_PUZZLE( DataStream &dData ) { ReadInputData( "input.puzzle.txt", dData ); }
-
-// ==========   OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    cout << iData;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (auto &e : dData) {
-        PrintDatum( e );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data, by calling the appropriate input function that is associated
-// with the global program phase var
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST:    GetData_TEST(    dData ); break;
-        case PUZZLE:  GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> program phase not recognized: " << glbProgPhase << endl;
-    }
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-// Returns true if the datastream segment of length nrDifferent and ending with index 'index'
-// contains all different characters. Returns false otherwise.
-bool NrDifferentFound( DataStream &dData, int index, int nrDifferent ) {
-    bool bUnEqual = true;
-    for (int j = nrDifferent - 1; j > 0 && bUnEqual; j--) {
-        for (int k = j - 1; k >= 0 && bUnEqual; k--) {
-            bUnEqual = ( dData[index - j] != dData[index - k] );
-        }
-    }
-    return bUnEqual;
-}
-
-// A regular marker is 4 different characters. A Start Of Message marker is 14 different characters
-bool IsMarkerFound( DataStream &dData, int i ) { return NrDifferentFound( dData, i,  4 ); }
-bool IsSOMFound(    DataStream &dData, int i ) { return NrDifferentFound( dData, i, 14 ); }
-
-// return the first end index of the segment in Datastream that is of length nrDiff and contains
-// only different characters
-int FindFirstPattern( DataStream &dData, int nrDiff ) {
-    int result = -1;
-    bool bFound = false;
-    for (int i = nrDiff - 1; i < (int)dData.size() && !bFound; i++) {
-        if (NrDifferentFound( dData, i, nrDiff )) {
-            result = i;
-            bFound = true;
-        }
-    }
-    return result;
-}
-
-// A regular marker is 4 different characters. A Start Of Message marker is 14 different characters
-int FindFirstMarker( DataStream &dData ) { return FindFirstPattern( dData,  4 ); }
-int FindFirstSOM(    DataStream &dData ) { return FindFirstPattern( dData, 14 ); }
-
-// ==========   MAIN()
-
-int main()
-{
-    glbProgPhase = PUZZLE;     // program phase to EXAMPLE, TEST or PUZZLE
-
-    flcTimer tmr;
-    tmr.StartTiming(); // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream signalData;
-    GetInput( signalData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << signalData.size() << endl << endl;
-
-    tmr.TimeReport( "Timing data input: " );   // ====================^^^^^vvvvv
-
-// ========== part 1
-
-    int nAnswer1 = FindFirstMarker( signalData );
-    cout << endl << "Answer 1 - first marker found at index: " << nAnswer1 << " (which is " << nAnswer1+1 << "th letter!)" << endl << endl;
-
-    tmr.TimeReport( "Timing 1: " );   // ==============================^^^^^
-
-// ========== part 2
-
-    int nAnswer2 = FindFirstSOM( signalData );
-    cout << endl << "Answer 2 - first start of message marker found at index: " << nAnswer2 << " (which is " << nAnswer2+1 << "th letter!)" << endl << endl;
-
-    tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
+// AoC 2022 - day 06 - Tuning Trouble
+// ==================================
+
+// date:  2022-12-06
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcStreamReader.h"
+#include "../flcInputCache.h"
+
+using namespace std;
+
+namespace day06 {
+
+// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+// the data consists of 'signals' modeled by characters
+// put them in a vector since I'm unsure of string length boundaries getting in the way
+typedef char DatumType;
+typedef vector<DatumType> DataStream;
+
+// ==========   DATA INPUT FUNCTIONS
+
+// hardcoded input - just to get the solution tested
+void GetData_EXAMPLE( DataStream &dData ) {
+    string auxData = "mjqjpqmgbljsphdztnvjfqwrcgsmlb";     // the puzzle provides multiple examples
+//    string auxData = "bvwbjplbgvbhsrlpgdmjqwftvncz";
+//    string auxData = "nppdvjthqldpwncqszvftbrmjlhg";
+//    string auxData = "nznrnfrfntjfmvfwmzdfjlvtqnbhcprsg";
+//    string auxData = "zcfzfwzzqfrljwzlrfnpqdbhtmscgvjw";
+
+    // convert string to vector of char's
+    for (int i = 0; i < (int)auxData.length(); i++) {
+        dData.push_back( auxData[i] );
+    }
+}
+
+// file input - reads 1 line at a time from .txt file, and process it into vData
+// adapt the parsing and processing of the lines to match the puzzle input
+void ReadInputData( const string sFileName, DataStream &vData ) {
+    flcInputFile inputFile( sFileName );
+    vData.clear();
+
+    for (auto sLine : inputFile.Lines()) {    // for this particular puzzle I expect only 1 line of data
+        vData.insert( vData.end(), sLine.begin(), sLine.end());
+    }
+}
+
+// input generator - writes one datastream of nSize characters. Up to the last 14 characters the
+// stream only uses the letters a, b and c, so both markers are found at the very end
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    string sMarker = "defghijklmnopqrstuvwxyz";
+    rng.Shuffle( sMarker );
+    for (long long i = 14; i < nSize; i++) {
+        os << char( 'a' + rng.Range( 0, 2 ));
+    }
+    os << sMarker.substr( 0, 14 ) << "\n";
+}
+
+// ==========   OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( DatumType &iData ) {
+    cout << iData;
+}
+
+// output to console for testing
+void PrintDataStream( DataStream &dData ) {
+    for (auto &e : dData) {
+        PrintDatum( e );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data, by calling the appropriate input function that is associated
+// with the global program phase var
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST:
+        case PUZZLE:  ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> program phase not recognized: " << ePhase << endl;
+    }
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+// Returns true if the datastream segment of length nrDifferent and ending with index 'index'
+// contains all different characters. Returns false otherwise.
+bool NrDifferentFound( DataStream &dData, int index, int nrDifferent ) {
+    bool bUnEqual = true;
+    for (int j = nrDifferent - 1; j > 0 && bUnEqual; j--) {
+        for (int k = j - 1; k >= 0 && bUnEqual; k--) {
+            bUnEqual = ( dData[index - j] != dData[index - k] );
+        }
+    }
+    return bUnEqual;
+}
+
+// A regular marker is 4 different characters. A Start Of Message marker is 14 different characters
+bool IsMarkerFound( DataStream &dData, int i ) { return NrDifferentFound( dData, i,  4 ); }
+bool IsSOMFound(    DataStream &dData, int i ) { return NrDifferentFound( dData, i, 14 ); }
+
+// return the first end index of the segment in Datastream that is of length nrDiff and contains
+// only different characters
+int FindFirstPattern( DataStream &dData, int nrDiff ) {
+    int result = -1;
+    bool bFound = false;
+    for (int i = nrDiff - 1; i < (int)dData.size() && !bFound; i++) {
+        if (NrDifferentFound( dData, i, nrDiff )) {
+            result = i;
+            bFound = true;
+        }
+    }
+    return result;
+}
+
+// A regular marker is 4 different characters. A Start Of Message marker is 14 different characters
+int FindFirstMarker( DataStream &dData ) { return FindFirstPattern( dData,  4 ); }
+int FindFirstSOM(    DataStream &dData ) { return FindFirstPattern( dData, 14 ); }
+
+// For the streaming mode the datastream is fed to a scanner one character at a time. Per character
+// value the scanner keeps the index where it was last seen, so it knows in O(1) where the current
+// segment of all different characters starts.
+typedef struct sPatternScanStruct {
+    int       nrDiff;
+    long long nStart = 0;          // start index of the current segment of all different characters
+    long long nFound = -1;         // end index of the first pattern, -1 as long as not found
+    long long vLastSeen[256];
+} PatternScanType;
+
+void InitScan( PatternScanType &scan, int nrDiff ) {
+    scan.nrDiff = nrDiff;
+    for (auto &e : scan.vLastSeen) {
+        e = -1;
+    }
+}
+
+// processes the character c at index in the datastream
+void ScanChar( PatternScanType &scan, long long index, unsigned char c ) {
+    if (scan.nFound < 0) {
+        scan.nStart = max( scan.nStart, scan.vLastSeen[c] + 1 );
+        scan.vLastSeen[c] = index;
+        if (index - scan.nStart + 1 >= scan.nrDiff) {
+            scan.nFound = index;
+        }
+    }
+}
+
+// ==========   RUNNER INTERFACE
+
+class Day06 : public aocDay {
+public:
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day06::GetInput( signalData, ePhase, sFileName, ePhase != PUZZLE );
+    }
+    size_t DataSize() { return signalData.size(); }
+    // nSize is the length of the datastream
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( signalData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { ePhase = eRunPhase; return reader.GetAll( signalData ); }
+
+// ========== part 1
+
+    // the puzzle asks for the nr of characters processed, which is index + 1
+    string SolvePart1() { return to_string( FindFirstMarker( signalData ) + 1 ); }
+
+// ========== part 2
+
+    string SolvePart2() { return to_string( FindFirstSOM( signalData ) + 1 ); }
+
+// ========== streaming - both parts in one pass
+
+    // the reading stops as soon as both markers are found
+    bool SolveStreaming( flcStreamReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        PatternScanType marker, som;
+        InitScan( marker,  4 );
+        InitScan( som,    14 );
+
+        long long index = 0;
+        string_view sChunk;
+        while (som.nFound < 0 && reader.NextChunk( sChunk )) {
+            for (int i = 0; i < (int)sChunk.length() && som.nFound < 0; i++) {
+                if (sChunk[i] != '\n' && sChunk[i] != '\r') {    // the lines are concatenated, like in ReadInputData()
+                    ScanChar( marker, index, sChunk[i] );
+                    ScanChar( som,    index, sChunk[i] );
+                    index += 1;
+                }
+            }
+        }
+        sAnswer1 = to_string( marker.nFound + 1 );
+        sAnswer2 = to_string( som.nFound    + 1 );
+        return true;
+    }
+
+private:
+    DataStream signalData;
+};
+
+aocRegistrar registrar( 6, "Tuning Trouble", aocCreateDay<Day06> );
+
+} // namespace day06
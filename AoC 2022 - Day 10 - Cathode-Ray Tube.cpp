@@ -1,225 +1,337 @@
-// AoC 2022 - day 10 Cathode-Ray Tube
-// ==================================
-
-// date:  2022-12-10
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0, TEST, PUZZLE
-} glbProgPhase;
-
-// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-// the data consists of 'instructions' having an opcode (name) and optional integer value
-// and a number of cycles
-typedef struct datumStruct {
-    string sOpcode  = "empty";
-    int    nOperand = 0;
-    int    nCycles  = 0;
-} DatumType;
-typedef vector<DatumType> DataStream;
-
-// there's one register X that initially holds value 1
-// a state vector keeps track of what X's value is at any cycle
-typedef struct registerStruct {
-    int nCycle;
-    int nValue;
-} RegisterType;
-vector<RegisterType> glbX;
-
-// ==========   DATA INPUT FUNCTIONS
-
-// hardcoded input - just to get the solution tested
-void GetData_EXAMPLE( DataStream &dData ) {
-    DatumType aux;
-    aux.sOpcode = "noop";                    aux.nCycles = 1; dData.push_back( aux );
-    aux.sOpcode = "addx"; aux.nOperand =  3; aux.nCycles = 2; dData.push_back( aux );
-    aux.sOpcode = "addx"; aux.nOperand = -5; aux.nCycles = 2; dData.push_back( aux );
-}
-
-// Cuts of and returns the front token from "input_to_be_adapted", using "delim" as delimiter.
-// If delimiter is not found, the complete input string is passed as a token.
-// The input string becomes shorter as a result, and may even become empty
-string get_token_dlmtd( const string &delim, string &input_to_be_adapted ) {
-    size_t splitIndex = input_to_be_adapted.find( delim );
-    string token = input_to_be_adapted.substr( 0, splitIndex );
-    input_to_be_adapted = (splitIndex == string::npos) ? "" : input_to_be_adapted.substr( splitIndex + 1 );
-    return token;
-}
-
-// file input - this function reads text file one line at a time - adapt code to match your need for line parsing!
-void ReadInputData( const string sFileName, DataStream &vData ) {
-    ifstream dataFileStream( sFileName );
-    vData.clear();
-    string sLine;
-    DatumType datum;
-    while (getline( dataFileStream, sLine )) {
-        if (sLine.length() > 0) {    // non empty line
-            string sToken = get_token_dlmtd( " ", sLine );
-            if (sToken == "noop") {
-                datum.sOpcode = sToken;
-                datum.nCycles = 1;
-            } else if (sToken == "addx") {
-                datum.sOpcode = sToken;
-                datum.nOperand = atoi( sLine.c_str());
-                datum.nCycles = 2;
-            } else {
-                cout << "ERROR: ReadInputData() --> unknown opcode: " << sToken << endl;
-            }
-            vData.push_back( datum );
-        }
-    }
-    dataFileStream.close();
-}
-
-void GetData_TEST(   DataStream &dData ) { ReadInputData( "input.test.txt", dData ); }
-void GetData_PUZZLE( DataStream &dData ) { ReadInputData( "input.puzzle.txt", dData ); }
-
-// ==========   OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    cout << "(cycles: " << iData.nCycles << "):    " << iData.sOpcode << " " << iData.nOperand << endl;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (int i = 0; i < (int)dData.size(); i++) {
-        cout << "Instr. " << i << " ";
-        PrintDatum( dData[i] );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data, by calling the appropriate input function that is associated
-// with the global program phase var
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST:    GetData_TEST(    dData ); break;
-        case PUZZLE:  GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> program phase not recognized: " << glbProgPhase << endl;
-    }
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-void RunProgram( DataStream &dData ) {
-    // start with clean x register state
-    glbX.clear();
-    int xValue = 1;
-    int nCycleCount = 0;
-    glbX.push_back( { nCycleCount, xValue } );     // register X starts with value 1 at cycle 0
-
-    // iterate over all instructions in the program
-    for (int i = 0; i < (int)dData.size(); i++) {
-        DatumType &curInstr = dData[i];
-
-        if (curInstr.sOpcode == "noop") {          // push one cycle and leave xValue unchanged
-            nCycleCount += 1;
-            glbX.push_back( { nCycleCount, xValue } );
-
-        } else if (curInstr.sOpcode == "addx") {   // push two cycles and alter xValue
-            nCycleCount += 1;
-            glbX.push_back( { nCycleCount, xValue } );
-            nCycleCount += 1;
-            glbX.push_back( { nCycleCount, xValue } );
-            xValue += curInstr.nOperand;
-        } else {
-            cout << "ERROR: RunProgram() --> unknown opcode: " << curInstr.sOpcode << endl;
-
-        }
-    }
-    // make sure to add last xValue to the glbX vector to make it apparent
-    nCycleCount += 1;
-    glbX.push_back( { nCycleCount, xValue } );
-}
-
-// ==========   MAIN()
-
-int main()
-{
-    glbProgPhase = PUZZLE;     // program phase to EXAMPLE, TEST or PUZZLE
-
-    flcTimer tmr;
-    tmr.StartTiming(); // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream progData;
-    GetInput( progData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << progData.size() << endl << endl;
-
-    tmr.TimeReport( "Timing 0: " );   // =========================^^^^^vvvvv
-
-// ========== part 1
-
-    // trigger at selected cycles
-    auto select_condition = [=]( int cycle ) {
-        return (cycle % 40 == 20);
-    };
-
-    RunProgram( progData );
-
-    int nCumulatedSignalStrenght = 0;
-    for (int i = 0; i < (int)glbX.size(); i++) {
-
-        // debug output in EXAMPLE or TEST phases
-        if (glbProgPhase != PUZZLE)
-            cout << "During " << glbX[i].nCycle << "-th cycle X = " << glbX[i].nValue;
-
-        if (select_condition( glbX[i].nCycle )) {
-
-            // debug output in EXAMPLE or TEST phases
-            if (glbProgPhase != PUZZLE)
-                cout << " --> signal strenght: " << glbX[i].nCycle << " * " << glbX[i].nValue << " = " << glbX[i].nCycle * glbX[i].nValue;
-
-            nCumulatedSignalStrenght += glbX[i].nCycle * glbX[i].nValue;
-        }
-
-        // debug output in EXAMPLE or TEST phases
-        if (glbProgPhase != PUZZLE)
-            cout << endl;
-    }
-    cout << endl << "Answer 1 - accumulated signal strength: " << nCumulatedSignalStrenght << endl << endl;
-
-    tmr.TimeReport( "Timing 1: " );   // =========================^^^^^vvvvv
-
-// ========== part 2
-
-    // check if denoted column (nCol) is masked by value nVal
-    auto sprite_mask = [=]( int nVal, int nCol ) {
-        return (nVal - 1 <= nCol && nCol <= nVal + 1);
-    };
-
-    // start at cycle 1
-    for (int i = 1; i < (int)glbX.size(); i++) {
-        int nCol = (i - 1) % 40;
-        if (nCol == 0)
-            cout << endl;
-        // using a space instead of a dot makes better readability
-        cout << (sprite_mask( glbX[i].nValue, nCol ) ? "#" : " ");
-    }
-    cout << endl;
-
-    tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
+// AoC 2022 - day 10 Cathode-Ray Tube
+// ==================================
+
+// date:  2022-12-10
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcTokenizer.h"
+#include "../flcStreamReader.h"
+#include "../flcPipeline.h"
+#include "../flcInputCache.h"
+
+using namespace std;
+
+namespace day10 {
+
+// ==========   DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+// the data consists of 'instructions' having an opcode (name) and optional integer value
+// and a number of cycles
+typedef struct datumStruct {
+    string sOpcode  = "empty";
+    int    nOperand = 0;
+    int    nCycles  = 0;
+} DatumType;
+typedef vector<DatumType> DataStream;
+
+// for the input cache (see flcInputCache.h)
+void flcCacheWrite( flcCacheWriter &w, const DatumType &d ) { w.Put( d.sOpcode ); w.Put( d.nOperand ); w.Put( d.nCycles ); }
+bool flcCacheRead(  flcCacheReader &r,       DatumType &d ) { return r.Get( d.sOpcode ) && r.Get( d.nOperand ) && r.Get( d.nCycles ); }
+
+// there's one register X that initially holds value 1
+// a state vector keeps track of what X's value is at any cycle
+typedef struct registerStruct {
+    int nCycle;
+    int nValue;
+} RegisterType;
+typedef vector<RegisterType> RegisterStream;
+
+// ==========   DATA INPUT FUNCTIONS
+
+// hardcoded input - just to get the solution tested
+void GetData_EXAMPLE( DataStream &dData ) {
+    DatumType aux;
+    aux.sOpcode = "noop";                    aux.nCycles = 1; dData.push_back( aux );
+    aux.sOpcode = "addx"; aux.nOperand =  3; aux.nCycles = 2; dData.push_back( aux );
+    aux.sOpcode = "addx"; aux.nOperand = -5; aux.nCycles = 2; dData.push_back( aux );
+}
+
+// file input - this function reads text file one line at a time - adapt code to match your need for line parsing!
+void ReadInputData( const string sFileName, DataStream &vData ) {
+    flcInputFile inputFile( sFileName );
+    vData.clear();
+    DatumType datum;
+    for (auto sLine : inputFile.Lines()) {
+        if (sLine.length() > 0) {    // non empty line
+            flcTokenizer tok( sLine );
+            string_view sToken = tok.NextDelimited( " " );
+            if (sToken == "noop") {
+                datum.sOpcode = sToken;
+                datum.nCycles = 1;
+            } else if (sToken == "addx") {
+                datum.sOpcode = sToken;
+                datum.nOperand = tok.NextNumber<int>();
+                datum.nCycles = 2;
+            } else {
+                cout << "ERROR: ReadInputData() --> unknown opcode: " << sToken << endl;
+            }
+            vData.push_back( datum );
+        }
+    }
+}
+
+// input generator - writes a program of nSize instructions. The addx operands keep register X
+// within the 40 columns of the CRT (give or take one)
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    long long nX = 1;
+    for (long long i = 0; i < nSize; i++) {
+        if (rng.Chance( 0.4 )) {
+            os << "noop\n";
+        } else {
+            long long nV;
+            do {
+                nV = rng.Range( -15, 15 );
+            } while (nV == 0 || nX + nV < -1 || nX + nV > 40);
+            nX += nV;
+            os << "addx " << nV << "\n";
+        }
+    }
+}
+
+// ==========   OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( DatumType &iData ) {
+    cout << "(cycles: " << iData.nCycles << "):    " << iData.sOpcode << " " << iData.nOperand << endl;
+}
+
+// output to console for testing
+void PrintDataStream( DataStream &dData ) {
+    for (int i = 0; i < (int)dData.size(); i++) {
+        cout << "Instr. " << i << " ";
+        PrintDatum( dData[i] );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data, by calling the appropriate input function that is associated
+// with the global program phase var
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST:
+        case PUZZLE:  ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> program phase not recognized: " << ePhase << endl;
+    }
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+void RunProgram( DataStream &dData, RegisterStream &vX ) {
+    // start with clean x register state
+    vX.clear();
+    int xValue = 1;
+    int nCycleCount = 0;
+    vX.push_back( { nCycleCount, xValue } );     // register X starts with value 1 at cycle 0
+
+    // iterate over all instructions in the program
+    for (int i = 0; i < (int)dData.size(); i++) {
+        DatumType &curInstr = dData[i];
+
+        if (curInstr.sOpcode == "noop") {          // push one cycle and leave xValue unchanged
+            nCycleCount += 1;
+            vX.push_back( { nCycleCount, xValue } );
+
+        } else if (curInstr.sOpcode == "addx") {   // push two cycles and alter xValue
+            nCycleCount += 1;
+            vX.push_back( { nCycleCount, xValue } );
+            nCycleCount += 1;
+            vX.push_back( { nCycleCount, xValue } );
+            xValue += curInstr.nOperand;
+        } else {
+            cout << "ERROR: RunProgram() --> unknown opcode: " << curInstr.sOpcode << endl;
+
+        }
+    }
+    // make sure to add last xValue to the vX vector to make it apparent
+    nCycleCount += 1;
+    vX.push_back( { nCycleCount, xValue } );
+}
+
+// For the streaming mode the register values are processed cycle by cycle, instead of being
+// collected in a RegisterStream first. Only the first nMaxPictureRows rows of the CRT picture are
+// kept (the CRT itself has 6 rows), so that the memory use doesn't grow with the program length.
+const int nMaxPictureRows = 8;
+
+typedef struct sCpuStreamStruct {
+    long long nCycle = 0;
+    int       xValue = 1;
+    long long nSignalStrength = 0;    // part 1
+    string    sPicture;               // part 2
+} CpuStreamType;
+
+// processes one cycle, with the current value of register X
+void StreamCycle( CpuStreamType &cpu ) {
+    cpu.nCycle += 1;
+    if (cpu.nCycle % 40 == 20) {
+        cpu.nSignalStrength += cpu.nCycle * cpu.xValue;
+    }
+    if (cpu.nCycle <= 40 * nMaxPictureRows) {
+        int nCol = (cpu.nCycle - 1) % 40;
+        if (nCol == 0)
+            cpu.sPicture.push_back( '\n' );
+        cpu.sPicture.push_back( (cpu.xValue - 1 <= nCol && nCol <= cpu.xValue + 1) ? '#' : ' ' );
+    }
+}
+
+// an instruction as its nr of cycles and the value to add to X afterwards - the record type of the pipelined solver
+typedef struct sInstrStruct {
+    int nCycles, nAddX;
+} InstrType;
+
+// ==========   RUNNER INTERFACE
+
+class Day10 : public aocDay {
+public:
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day10::GetInput( progData, ePhase, sFileName, ePhase != PUZZLE );
+    }
+    size_t DataSize() { return progData.size(); }
+    // nSize is the nr of instructions
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( progData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { ePhase = eRunPhase; return reader.GetAll( progData ); }
+
+// ========== part 1
+
+    string SolvePart1() {
+        // trigger at selected cycles
+        auto select_condition = [=]( int cycle ) {
+            return (cycle % 40 == 20);
+        };
+
+        RegisterStream vX;
+        RunProgram( progData, vX );
+
+        int nCumulatedSignalStrenght = 0;
+        for (int i = 0; i < (int)vX.size(); i++) {
+
+            // debug output in EXAMPLE or TEST phases
+            if (ePhase != PUZZLE)
+                cout << "During " << vX[i].nCycle << "-th cycle X = " << vX[i].nValue;
+
+            if (select_condition( vX[i].nCycle )) {
+
+                // debug output in EXAMPLE or TEST phases
+                if (ePhase != PUZZLE)
+                    cout << " --> signal strenght: " << vX[i].nCycle << " * " << vX[i].nValue << " = " << vX[i].nCycle * vX[i].nValue;
+
+                nCumulatedSignalStrenght += vX[i].nCycle * vX[i].nValue;
+            }
+
+            // debug output in EXAMPLE or TEST phases
+            if (ePhase != PUZZLE)
+                cout << endl;
+        }
+        return to_string( nCumulatedSignalStrenght );
+    }
+
+// ========== part 2
+
+    // the answer is the CRT picture, returned as a multi line string
+    string SolvePart2() {
+        // check if denoted column (nCol) is masked by value nVal
+        auto sprite_mask = [=]( int nVal, int nCol ) {
+            return (nVal - 1 <= nCol && nCol <= nVal + 1);
+        };
+
+        RegisterStream vX;
+        RunProgram( progData, vX );
+
+        string sPicture;
+        // start at cycle 1
+        for (int i = 1; i < (int)vX.size(); i++) {
+            int nCol = (i - 1) % 40;
+            if (nCol == 0)
+                sPicture.push_back( '\n' );
+            // using a space instead of a dot makes better readability
+            sPicture.push_back( sprite_mask( vX[i].nValue, nCol ) ? '#' : ' ' );
+        }
+        return sPicture;
+    }
+
+// ========== streaming - both parts in one pass
+
+    bool SolveStreaming( flcStreamReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        CpuStreamType cpu;
+        string_view sLine;
+        while (reader.NextLine( sLine )) {
+            if (sLine.length() > 0) {    // non empty line
+                flcTokenizer tok( sLine );
+                string_view sToken = tok.NextDelimited( " " );
+                if (sToken == "noop") {
+                    StreamCycle( cpu );
+                } else if (sToken == "addx") {
+                    StreamCycle( cpu );
+                    StreamCycle( cpu );
+                    cpu.xValue += tok.NextNumber<int>();
+                } else {
+                    cout << "ERROR: SolveStreaming() --> unknown opcode: " << sToken << endl;
+                }
+            }
+        }
+        // like in RunProgram(), the last value of X gets a cycle of its own
+        StreamCycle( cpu );
+
+        sAnswer1 = to_string( cpu.nSignalStrength );
+        sAnswer2 = cpu.sPicture;
+        return true;
+    }
+
+// ========== pipelined - both parts as a fold over the instructions
+
+    bool SolvePipelined( eProgPhase eRunPhase, flcBlockReader &reader, string &sAnswer1, string &sAnswer2 ) {
+        CpuStreamType cpu;
+        flcRunPipeline<InstrType>( reader,
+            []( string_view sLine, InstrType &instr ) {
+                if (sLine.length() == 0) {    // empty line
+                    return false;
+                }
+                flcTokenizer tok( sLine );
+                string_view sToken = tok.NextDelimited( " " );
+                if (sToken == "noop") {
+                    instr = { 1, 0 };
+                } else if (sToken == "addx") {
+                    instr = { 2, tok.NextNumber<int>() };
+                } else {
+                    cout << "ERROR: SolvePipelined() --> unknown opcode: " << sToken << endl;
+                    return false;
+                }
+                return true;
+            },
+            [&]( InstrType instr ) {
+                for (int i = 0; i < instr.nCycles; i++) {
+                    StreamCycle( cpu );
+                }
+                cpu.xValue += instr.nAddX;
+            }
+        );
+        // like in RunProgram(), the last value of X gets a cycle of its own
+        StreamCycle( cpu );
+
+        sAnswer1 = to_string( cpu.nSignalStrength );
+        sAnswer2 = cpu.sPicture;
+        return true;
+    }
+
+private:
+    DataStream progData;
+};
+
+aocRegistrar registrar( 10, "Cathode-Ray Tube", aocCreateDay<Day10> );
+
+} // namespace day10
@@ -1,310 +1,402 @@
-// AoC 2022 - day 11c - Monkey in the Middle
-// =========================================
-
-// date:  2022-12-25
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <deque>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0, TEST, PUZZLE
-} glbProgPhase;
-
-// ==========   INPUT DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-// the data consists of 'turns' having a first and second selection
-typedef struct datumStruct {
-    int nID         = -1;     // the id of the monkey
-    char cOperation = ' ';    // can be '*', '+' or '^' (for square)
-    int nOperand    = -1;     // belonging to the operation
-    int nDivider    = -1;     // for the monkey test
-    int nUponTrue   = -1;     // throw towards this monkey if test success
-    int nUponFalse  = -1;     // throw towards this monkey if test failure
-    deque<long long> vItems;
-} DatumType;
-typedef vector<DatumType> DataStream;
-
-// ==========   INPUT DATA FUNCTIONS
-
-// convenience function for code formatting purposes
-void MakeDatum( DatumType &datum, int id, char op, int opernd, int divr, int nTrue, int nFalse, deque<long long> items ) {
-    datum.nID        = id;
-    datum.cOperation = op;
-    datum.nOperand   = opernd;
-    datum.nDivider   = divr;
-    datum.nUponTrue  = nTrue;
-    datum.nUponFalse = nFalse;
-    datum.vItems     = items;
-}
-
-// hardcoded input - just to get the solution tested
-void GetData_EXAMPLE( DataStream &dData ) {
-    DatumType aux;
-
-    // id, operation, operand, divider, iftrue, iffalse, items
-    MakeDatum( aux, 0, '*', 19, 23, 2, 3, { 79, 98         } ); dData.push_back( aux );
-    MakeDatum( aux, 1, '+',  6, 19, 2, 0, { 54, 65, 75, 74 } ); dData.push_back( aux );
-    MakeDatum( aux, 2, '^',  0, 13, 1, 3, { 79, 60, 97     } ); dData.push_back( aux );
-    MakeDatum( aux, 3, '+',  3, 17, 0, 1, { 74             } ); dData.push_back( aux );
-}
-
-// hardcoded input - just to get the solution tested
-void GetData_TEST( DataStream &dData ) {
-    DatumType aux;
-
-    // id, operation, operand, divider, iftrue, iffalse, items
-    MakeDatum( aux, 0, '*', 13, 11, 3, 2, { 57                             } ); dData.push_back( aux );
-    MakeDatum( aux, 1, '+',  2,  7, 6, 7, { 58, 93, 88, 81, 72, 73, 65     } ); dData.push_back( aux );
-    MakeDatum( aux, 2, '+',  6, 13, 3, 5, { 65, 95                         } ); dData.push_back( aux );
-    MakeDatum( aux, 3, '^',  0,  5, 4, 5, { 58, 80, 81, 83                 } ); dData.push_back( aux );
-    MakeDatum( aux, 4, '+',  3,  3, 1, 7, { 58, 89, 90, 96, 55             } ); dData.push_back( aux );
-    MakeDatum( aux, 5, '*',  7, 17, 4, 1, { 66, 73, 87, 58, 62, 67         } ); dData.push_back( aux );
-    MakeDatum( aux, 6, '+',  4,  2, 2, 0, { 85, 55, 89                     } ); dData.push_back( aux );
-    MakeDatum( aux, 7, '+',  7, 19, 6, 0, { 73, 80, 54, 94, 90, 52, 69, 58 } ); dData.push_back( aux );
-}
-
-// There's no file reading in this puzzle - the puzzle input is also hardcoded
-void GetData_PUZZLE( DataStream &dData ) { GetData_TEST( dData ); }
-
-// ==========   CONSOLE OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    cout << "Monkey ID: " << iData.nID;
-    cout << ", operation: " << iData.cOperation << " " << iData.nOperand;
-    cout << ", divider: " << iData.nDivider << " ? " << iData.nUponTrue << " : " << iData.nUponFalse;
-    cout << ", nr of items: " << iData.vItems.size();
-    cout << " = { ";
-    for (int i = 0; i < (int)iData.vItems.size(); i++) {
-        cout << iData.vItems[i] << " ";
-    }
-    cout << " } " << endl;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (auto &e : dData) {
-        PrintDatum( e );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data, by calling the appropriate input function that is associated
-// with the global program phase var
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST   : GetData_TEST(    dData ); break;
-        case PUZZLE : GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> unknown program phase: " << glbProgPhase << endl;
-    }
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-// for the puzzle you need to record how many times
-// each monkey makes an inspect of an item
-typedef struct sPuzzleStruct {
-    int monkeyID;
-    long long nrInspects;
-} PuzzleType;
-vector<PuzzleType> vInspects;
-
-// simulates on turn for one monkey (with index curM)
-void MonkeyTurn1( DataStream &mData, int curM ) {
-    DatumType &curMonkey = mData[curM];
-
-    while (!curMonkey.vItems.empty()) {
-        // 1. inspect next item
-        long long curItemVal = curMonkey.vItems.front();
-        curMonkey.vItems.pop_front();
-
-        vInspects[curMonkey.nID].nrInspects += 1;
-
-        // 2. apply operation on item
-        long long newItemVal;
-        switch (curMonkey.cOperation) {
-            case '*': newItemVal = curItemVal * curMonkey.nOperand; break;
-            case '+': newItemVal = curItemVal + curMonkey.nOperand; break;
-            case '^': newItemVal = curItemVal * curItemVal; break;
-            default : newItemVal = -1;
-        }
-
-        // 3. get bored with item
-        newItemVal = (long long)( float( newItemVal ) / 3.0f );
-
-        // 4. perform test
-        bool bTestResult = (newItemVal % curMonkey.nDivider == 0);
-
-        // 5. throw item to another monkey
-        int nMonkeyToThrowTo = (bTestResult ? curMonkey.nUponTrue : curMonkey.nUponFalse);
-        mData[ nMonkeyToThrowTo ].vItems.push_back( newItemVal );
-    }
-}
-
-// let each monkey - in order - have it's turn
-void MonkeyRound1( DataStream &mData ) {
-    for (int i = 0; i < (int)mData.size(); i++) {
-        MonkeyTurn1( mData, i );
-    }
-}
-
-// part 2 ----------
-
-// the idea is to encapsulate the calculation in a modular space, by applying a global
-// modulus factor on each outcome. This factor is determined by multiplying all dividers for
-// all monkeys. This way the numbers are kept within a reasonable bound, while all the division
-// tests are not impacted... :)
-long long glbModulusFactor = -1;
-
-void InitModulusFactor( DataStream &iData ) {
-    glbModulusFactor = 1;
-    for (int i = 0; i < (int)iData.size(); i++) {
-        glbModulusFactor *= iData[i].nDivider;
-    }
-}
-
-// this is a variant of MonkeyTurn1() where all calculation are kept in modular space
-void MonkeyTurn2( DataStream &mData, int curM ) {
-    DatumType &curMonkey = mData[curM];
-
-    while (!curMonkey.vItems.empty()) {
-        // 1. inspect next item
-        long long curItemVal = curMonkey.vItems.front();
-        curMonkey.vItems.pop_front();
-
-        vInspects[curMonkey.nID].nrInspects += 1;
-
-        // 2. apply operation on item
-        long long newItemVal;
-        switch (curMonkey.cOperation) {
-            case '*': newItemVal = curItemVal * curMonkey.nOperand; break;
-            case '+': newItemVal = curItemVal + curMonkey.nOperand; break;
-            case '^': newItemVal = curItemVal * curItemVal; break;
-            default : newItemVal = -1;
-        }
-        // make sure to stay within modular math
-        newItemVal = newItemVal % glbModulusFactor;
-
-        // 4. perform test
-        bool bTestResult = (newItemVal % curMonkey.nDivider == 0);
-
-        // 5. throw item to another monkey
-        int nMonkeyToThrowTo = (bTestResult ? curMonkey.nUponTrue : curMonkey.nUponFalse);
-        mData[ nMonkeyToThrowTo ].vItems.push_back( newItemVal );
-    }
-}
-
-// let each monkey - in order - have it's turn
-void MonkeyRound2( DataStream &mData ) {
-    for (int i = 0; i < (int)mData.size(); i++) {
-        MonkeyTurn2( mData, i );
-    }
-}
-
-// ==========   MAIN()
-
-int main()
-{
-    glbProgPhase = PUZZLE;     // program phase to EXAMPLE, TEST or PUZZLE
-    flcTimer tmr;
-
-/* ========== */   tmr.StartTiming();   // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream inputData;
-    GetInput( inputData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << inputData.size() << endl << endl;
-
-/* ========== */   tmr.TimeReport( "Timing 0: " );   // =========================^^^^^vvvvv
-
-    // part 1 code here
-
-    // initialize / clear the inspect count list
-    vInspects.resize( inputData.size());
-    for (int i = 0; i < (int)vInspects.size(); i++) {
-        vInspects[i].monkeyID = i;
-        vInspects[i].nrInspects = 0;
-    }
-
-    for (int i = 0; i < 20; i++) {
-        MonkeyRound1( inputData );
-//        cout << "Results after round " << i + 1 << endl << endl;
-//        PrintDataStream( inputData );
-    }
-
-    // output and then sort all inspection counts per monkey
-//    for (int i = 0; i < (int) vInspects.size(); i++) {
-//        cout << "Monkey " << i << " inspected items " << vInspects[i].nrInspects << " times." << endl;
-//    }
-    sort( vInspects.begin(), vInspects.end(),
-        []( PuzzleType a, PuzzleType b ) {
-            return a.nrInspects > b.nrInspects;
-        }
-    );
-    // report the answer - the two highest inspection counts multiplied
-    cout << endl << "Answer 1 - level of monkey business: " << vInspects[0].nrInspects * vInspects[1].nrInspects << endl << endl;
-
-/* ========== */   tmr.TimeReport( "Timing 1: " );   // =========================^^^^^vvvvv
-
-    // part 2 code here
-
-    // re-read inputdata
-    inputData.clear();
-    GetInput( inputData, false );
-    // init glbModulusFactor to enable working in modular space
-    InitModulusFactor( inputData );
-//    cout << "Factor to work within modular math = " << glbModulusFactor << endl;
-
-    // clear vInspects vector
-    for (int i = 0; i < (int)vInspects.size(); i++) {
-        vInspects[i].monkeyID = i;
-        vInspects[i].nrInspects = 0;
-    }
-
-    // output only at these triggers
-//    vector<int> triggers = { 1, 20, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000 };
-    vector<int> triggers = {  };
-    // collect inspection counts per monkey for 10000 rounds
-    for (int i = 1; i <= 10000; i++) {
-        MonkeyRound2( inputData );
-
-        if (find( triggers.begin(), triggers.end(), i ) != triggers.end()) {
-            cout << "Results after round " << i << endl;
-            cout << "=================== " <<      endl;
-//            PrintDataStream( inputData );
-            for (int j = 0; j < (int) vInspects.size(); j++) {
-                cout << "Monkey " << j << " inspected items " << vInspects[j].nrInspects << " times." << endl;
-            }
-        }
-    }
-    // sort the inspection count list to get the highest two values
-    sort( vInspects.begin(), vInspects.end(),
-        []( PuzzleType a, PuzzleType b ) {
-            return a.nrInspects > b.nrInspects;
-        }
-    );
-    // report the answer - the two highest inspection counts multiplied
-    cout << endl << "Answer 2 - level of monkey business: " << vInspects[0].nrInspects * vInspects[1].nrInspects << endl << endl;
-
-/* ========== */   tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
+// AoC 2022 - day 11c - Monkey in the Middle
+// =========================================
+
+// date:  2022-12-25
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcTokenizer.h"
+#include "../flcInputCache.h"
+
+using namespace std;
+
+namespace day11 {
+
+// ==========   INPUT DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+// the data consists of 'turns' having a first and second selection
+typedef struct datumStruct {
+    int nID         = -1;     // the id of the monkey
+    char cOperation = ' ';    // can be '*', '+' or '^' (for square)
+    int nOperand    = -1;     // belonging to the operation
+    int nDivider    = -1;     // for the monkey test
+    int nUponTrue   = -1;     // throw towards this monkey if test success
+    int nUponFalse  = -1;     // throw towards this monkey if test failure
+    deque<long long> vItems;
+} DatumType;
+typedef vector<DatumType> DataStream;
+
+// for the input cache (see flcInputCache.h)
+void flcCacheWrite( flcCacheWriter &w, const DatumType &d ) {
+    w.Put( d.nID ); w.Put( d.cOperation ); w.Put( d.nOperand ); w.Put( d.nDivider ); w.Put( d.nUponTrue ); w.Put( d.nUponFalse );
+    w.Put( d.vItems );
+}
+bool flcCacheRead( flcCacheReader &r, DatumType &d ) {
+    return r.Get( d.nID ) && r.Get( d.cOperation ) && r.Get( d.nOperand ) && r.Get( d.nDivider ) && r.Get( d.nUponTrue ) && r.Get( d.nUponFalse ) &&
+           r.Get( d.vItems );
+}
+
+// ==========   INPUT DATA FUNCTIONS
+
+// convenience function for code formatting purposes
+void MakeDatum( DatumType &datum, int id, char op, int opernd, int divr, int nTrue, int nFalse, deque<long long> items ) {
+    datum.nID        = id;
+    datum.cOperation = op;
+    datum.nOperand   = opernd;
+    datum.nDivider   = divr;
+    datum.nUponTrue  = nTrue;
+    datum.nUponFalse = nFalse;
+    datum.vItems     = items;
+}
+
+// hardcoded input - just to get the solution tested
+void GetData_EXAMPLE( DataStream &dData ) {
+    DatumType aux;
+
+    // id, operation, operand, divider, iftrue, iffalse, items
+    MakeDatum( aux, 0, '*', 19, 23, 2, 3, { 79, 98         } ); dData.push_back( aux );
+    MakeDatum( aux, 1, '+',  6, 19, 2, 0, { 54, 65, 75, 74 } ); dData.push_back( aux );
+    MakeDatum( aux, 2, '^',  0, 13, 1, 3, { 79, 60, 97     } ); dData.push_back( aux );
+    MakeDatum( aux, 3, '+',  3, 17, 0, 1, { 74             } ); dData.push_back( aux );
+}
+
+// file input - each monkey is described in a block of 6 lines, like:
+//     Monkey 0:
+//       Starting items: 79, 98
+//       Operation: new = old * 19
+//       Test: divisible by 23
+//         If true: throw to monkey 2
+//         If false: throw to monkey 3
+// The input is checked after reading: each monkey must be complete, have its index as id, a positive
+// divider and throw to existing monkeys. If not, an error is reported and vData is left empty.
+void ReadInputData( const string sFileName, DataStream &vData ) {
+    flcInputFile inputFile( sFileName );
+    vData.clear();
+    DatumType datum;
+    int nMonkeys = 0;    // nr of "Monkey" lines - each must be followed by a complete description
+
+    for (auto sLine : inputFile.Lines()) {
+        if (sLine.find( ':' ) == string_view::npos) continue;     // skip empty lines
+        flcTokenizer tok( sLine );
+        string_view sKey = tok.NextDelimited( ":" );
+        // the value of the last three keys is the number at the end of the line
+        string_view sLastNr = sLine.substr( sLine.rfind( ' ' ) + 1 );
+
+        if (sKey.find( "Monkey" ) != string_view::npos) {
+            datum = DatumType();
+            nMonkeys += 1;
+            datum.nID = flcToNumber<int>( sKey.substr( sKey.find( ' ' ) + 1 ));
+        } else if (sKey.find( "Starting items" ) != string_view::npos) {
+            while (!tok.Empty()) {
+                datum.vItems.push_back( tok.NextNumber<long long>( "," ));
+            }
+        } else if (sKey.find( "Operation" ) != string_view::npos) {
+            tok.NextDelimited( "old " );           // ignore " new = old "
+            string_view sOperator = tok.NextDelimited( " " );
+            if (tok.Rest() == "old") {             // "old * old" is a square
+                datum.cOperation = '^';
+                datum.nOperand   = 0;
+            } else {
+                datum.cOperation = sOperator.empty() ? ' ' : sOperator[0];
+                datum.nOperand   = tok.NextNumber<int>();
+            }
+        } else if (sKey.find( "Test" ) != string_view::npos) {
+            datum.nDivider = flcToNumber<int>( sLastNr );
+        } else if (sKey.find( "If true" ) != string_view::npos) {
+            datum.nUponTrue = flcToNumber<int>( sLastNr );
+        } else if (sKey.find( "If false" ) != string_view::npos) {
+            datum.nUponFalse = flcToNumber<int>( sLastNr );
+            vData.push_back( datum );              // this is the last line of a monkey description
+        } else {
+            cout << "ERROR: ReadInputData() --> unrecognized line: " << sLine << endl;
+        }
+    }
+
+    if (!inputFile.IsOpen()) {
+        return;    // the error is already reported
+    }
+    string sError;
+    if (vData.empty()) {
+        sError = "no monkeys found";
+    } else if (nMonkeys != (int)vData.size()) {
+        sError = "incomplete monkey description";
+    }
+    for (int i = 0; i < (int)vData.size() && sError.empty(); i++) {
+        const DatumType &m = vData[i];
+        int n = (int)vData.size();
+        if (m.nID != i || m.nDivider <= 0 || string( "*+^" ).find( m.cOperation ) == string::npos ||
+            m.nUponTrue < 0 || m.nUponTrue >= n || m.nUponFalse < 0 || m.nUponFalse >= n) {
+            sError = "invalid description of monkey " + to_string( i );
+        }
+    }
+    if (!sError.empty()) {
+        cout << "ERROR: ReadInputData() --> " << sError << " in input file: " << sFileName << endl;
+        vData.clear();
+    }
+}
+
+// input generator - writes the notes on 8 monkeys that hold nSize items in total. The tests use the
+// primes up to 19, so that the modulus factor of part 2 (their product) keeps the squares within
+// the long long range. Like in the real notes one monkey squares, two multiply and the others add
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    vector<int> vPrimes = { 2, 3, 5, 7, 11, 13, 17, 19 };
+    string sOps = "^**+++++";
+    rng.Shuffle( vPrimes );
+    rng.Shuffle( sOps );
+
+    vector<vector<long long>> vItems( 8 );
+    for (long long i = 0; i < nSize; i++) {
+        vItems[ rng.Range( 0, 7 ) ].push_back( rng.Range( 50, 99 ));
+    }
+    for (int m = 0; m < 8; m++) {
+        int nTrue = (m + rng.Range( 1, 7 )) % 8, nFalse;
+        do {
+            nFalse = (m + rng.Range( 1, 7 )) % 8;
+        } while (nFalse == nTrue);
+
+        os << "Monkey " << m << ":\n";
+        os << "  Starting items: ";
+        for (int i = 0; i < (int)vItems[m].size(); i++) {
+            os << (i == 0 ? "" : ", ") << vItems[m][i];
+        }
+        os << "\n  Operation: new = old ";
+        switch (sOps[m]) {
+            case '^': os << "* old";                  break;
+            case '*': os << "* " << rng.Range( 2, 19 ); break;
+            default:  os << "+ " << rng.Range( 1,  8 ); break;
+        }
+        os << "\n  Test: divisible by " << vPrimes[m] << "\n";
+        os << "    If true: throw to monkey "  << nTrue  << "\n";
+        os << "    If false: throw to monkey " << nFalse << "\n\n";
+    }
+}
+
+// ==========   CONSOLE OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( DatumType &iData ) {
+    cout << "Monkey ID: " << iData.nID;
+    cout << ", operation: " << iData.cOperation << " " << iData.nOperand;
+    cout << ", divider: " << iData.nDivider << " ? " << iData.nUponTrue << " : " << iData.nUponFalse;
+    cout << ", nr of items: " << iData.vItems.size();
+    cout << " = { ";
+    for (int i = 0; i < (int)iData.vItems.size(); i++) {
+        cout << iData.vItems[i] << " ";
+    }
+    cout << " } " << endl;
+}
+
+// output to console for testing
+void PrintDataStream( DataStream &dData ) {
+    for (auto &e : dData) {
+        PrintDatum( e );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data, by calling the appropriate input function that is associated
+// with the global program phase var
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST   :
+        case PUZZLE : ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> unknown program phase: " << ePhase << endl;
+    }
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+// for the puzzle you need to record how many times
+// each monkey makes an inspect of an item
+typedef struct sPuzzleStruct {
+    int monkeyID;
+    long long nrInspects;
+} PuzzleType;
+
+// the state of one simulation run - each part has its own
+typedef struct sRunContext {
+    vector<PuzzleType> vInspects;
+    long long nModulusFactor = -1;   // see InitModulusFactor()
+} RunContext;
+
+// initialize / clear the inspect count list
+void InitInspects( RunContext &ctx, int nrMonkeys ) {
+    ctx.vInspects.resize( nrMonkeys );
+    for (int i = 0; i < (int)ctx.vInspects.size(); i++) {
+        ctx.vInspects[i].monkeyID = i;
+        ctx.vInspects[i].nrInspects = 0;
+    }
+}
+
+// sort all inspection counts per monkey, and multiply the two highest ones (0 if there are less than two
+// monkeys, like after an input error)
+long long MonkeyBusiness( RunContext &ctx ) {
+    if (ctx.vInspects.size() < 2) {
+        return 0;
+    }
+    sort( ctx.vInspects.begin(), ctx.vInspects.end(),
+        []( PuzzleType a, PuzzleType b ) {
+            return a.nrInspects > b.nrInspects;
+        }
+    );
+    return ctx.vInspects[0].nrInspects * ctx.vInspects[1].nrInspects;
+}
+
+// simulates on turn for one monkey (with index curM)
+void MonkeyTurn1( RunContext &ctx, DataStream &mData, int curM ) {
+    DatumType &curMonkey = mData[curM];
+
+    while (!curMonkey.vItems.empty()) {
+        // 1. inspect next item
+        long long curItemVal = curMonkey.vItems.front();
+        curMonkey.vItems.pop_front();
+
+        ctx.vInspects[curMonkey.nID].nrInspects += 1;
+
+        // 2. apply operation on item
+        long long newItemVal;
+        switch (curMonkey.cOperation) {
+            case '*': newItemVal = curItemVal * curMonkey.nOperand; break;
+            case '+': newItemVal = curItemVal + curMonkey.nOperand; break;
+            case '^': newItemVal = curItemVal * curItemVal; break;
+            default : newItemVal = -1;
+        }
+
+        // 3. get bored with item
+        newItemVal = (long long)( float( newItemVal ) / 3.0f );
+
+        // 4. perform test
+        bool bTestResult = (newItemVal % curMonkey.nDivider == 0);
+
+        // 5. throw item to another monkey
+        int nMonkeyToThrowTo = (bTestResult ? curMonkey.nUponTrue : curMonkey.nUponFalse);
+        mData[ nMonkeyToThrowTo ].vItems.push_back( newItemVal );
+    }
+}
+
+// let each monkey - in order - have it's turn
+void MonkeyRound1( RunContext &ctx, DataStream &mData ) {
+    for (int i = 0; i < (int)mData.size(); i++) {
+        MonkeyTurn1( ctx, mData, i );
+    }
+}
+
+// part 2 ----------
+
+// the idea is to encapsulate the calculation in a modular space, by applying a global
+// modulus factor on each outcome. This factor is determined by multiplying all dividers for
+// all monkeys. This way the numbers are kept within a reasonable bound, while all the division
+// tests are not impacted... :)
+void InitModulusFactor( RunContext &ctx, DataStream &iData ) {
+    ctx.nModulusFactor = 1;
+    for (int i = 0; i < (int)iData.size(); i++) {
+        ctx.nModulusFactor *= iData[i].nDivider;
+    }
+}
+
+// this is a variant of MonkeyTurn1() where all calculation are kept in modular space
+void MonkeyTurn2( RunContext &ctx, DataStream &mData, int curM ) {
+    DatumType &curMonkey = mData[curM];
+
+    while (!curMonkey.vItems.empty()) {
+        // 1. inspect next item
+        long long curItemVal = curMonkey.vItems.front();
+        curMonkey.vItems.pop_front();
+
+        ctx.vInspects[curMonkey.nID].nrInspects += 1;
+
+        // 2. apply operation on item
+        long long newItemVal;
+        switch (curMonkey.cOperation) {
+            case '*': newItemVal = curItemVal * curMonkey.nOperand; break;
+            case '+': newItemVal = curItemVal + curMonkey.nOperand; break;
+            case '^': newItemVal = curItemVal * curItemVal; break;
+            default : newItemVal = -1;
+        }
+        // make sure to stay within modular math
+        newItemVal = newItemVal % ctx.nModulusFactor;
+
+        // 4. perform test
+        bool bTestResult = (newItemVal % curMonkey.nDivider == 0);
+
+        // 5. throw item to another monkey
+        int nMonkeyToThrowTo = (bTestResult ? curMonkey.nUponTrue : curMonkey.nUponFalse);
+        mData[ nMonkeyToThrowTo ].vItems.push_back( newItemVal );
+    }
+}
+
+// let each monkey - in order - have it's turn
+void MonkeyRound2( RunContext &ctx, DataStream &mData ) {
+    for (int i = 0; i < (int)mData.size(); i++) {
+        MonkeyTurn2( ctx, mData, i );
+    }
+}
+
+// ==========   RUNNER INTERFACE
+
+class Day11 : public aocDay {
+public:
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day11::GetInput( inputData, ePhase, sFileName, ePhase != PUZZLE );
+    }
+    size_t DataSize() { return inputData.size(); }
+    // nSize is the nr of items
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( inputData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { ePhase = eRunPhase; return reader.GetAll( inputData ); }
+
+// ========== part 1
+
+    string SolvePart1() {
+        // the monkeys throw items around, so work on a copy of the input data
+        DataStream monkeyData = inputData;
+        RunContext ctx;
+        InitInspects( ctx, monkeyData.size());
+
+        for (int i = 0; i < 20; i++) {
+            MonkeyRound1( ctx, monkeyData );
+        }
+        // the answer is the two highest inspection counts multiplied
+        return to_string( MonkeyBusiness( ctx ));
+    }
+
+// ========== part 2
+
+    string SolvePart2() {
+        // start again from the original input data
+        DataStream monkeyData = inputData;
+        RunContext ctx;
+        InitInspects( ctx, monkeyData.size());
+        // init modulus factor to enable working in modular space
+        InitModulusFactor( ctx, monkeyData );
+
+        // collect inspection counts per monkey for 10000 rounds
+        for (int i = 1; i <= 10000; i++) {
+            MonkeyRound2( ctx, monkeyData );
+        }
+        // the answer is the two highest inspection counts multiplied
+        return to_string( MonkeyBusiness( ctx ));
+    }
+
+private:
+    DataStream inputData;
+};
+
+aocRegistrar registrar( 11, "Monkey in the Middle", aocCreateDay<Day11> );
+
+} // namespace day11
@@ -1,413 +1,410 @@
-// AoC 2022 - day 13 - Distress Signal
-// ===================================
-
-// date:  2022-12-13
-// by:    Joseph21 (Joseph21-6147)
-
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <algorithm>
-
-#include "../flcTimer.h"
-
-using namespace std;
-
-// ==========   PROGRAM PHASING
-
-enum eProgPhase {     // what programming phase are you in - set at start of main()
-    EXAMPLE = 0, TEST, PUZZLE
-} glbProgPhase;
-
-// ==========   INPUT DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
-
-#define EMPTY 0    // constants for nType field of SignalType
-#define INTGR 1
-#define LIST  2
-
-string TypeToString( int type ) {
-    string result;
-    switch (type) {
-        case EMPTY: result = "EMPTY"; break;
-        case INTGR: result = "INTGR"; break;
-        case LIST : result = "LIST";  break;
-    }
-    return result;
-}
-
-typedef struct signalStruct {
-    int nType = EMPTY;                    // one of EMPTY, INTGR or LIST
-    int nValue;                           // used in case of INTGR
-    vector<struct signalStruct *> vList;  // used in case of LIST
-    struct signalStruct *pParent = nullptr;
-} SignalType;
-
-// the input data consists of 'pairs of signals' having a first and second selection
-typedef struct datumStruct {
-    string sSig1, sSig2;
-    SignalType *pSig1 = nullptr;
-    SignalType *pSig2 = nullptr;
-} DatumType;
-typedef vector<DatumType> DataStream;
-
-// ==========   INPUT DATA FUNCTIONS
-
-// hardcoded input - just to get the solution tested
-void GetData_EXAMPLE( DataStream &dData ) {
-    DatumType aux;
-    aux.sSig1 = "[1,1,3,1,1]";                 aux.sSig2 = "[1,1,5,1,1]";                  dData.push_back( aux );
-    aux.sSig1 = "[[1],[2,3,4]]";               aux.sSig2 = "[[1],4]";                      dData.push_back( aux );
-    aux.sSig1 = "[9]";                         aux.sSig2 = "[[8,7,6]]";                    dData.push_back( aux );
-    aux.sSig1 = "[[4,4],4,4]";                 aux.sSig2 = "[[4,4],4,4,4]";                dData.push_back( aux );
-    aux.sSig1 = "[7,7,7,7]";                   aux.sSig2 = "[7,7,7]";                      dData.push_back( aux );
-    aux.sSig1 = "[]";                          aux.sSig2 = "[3]";                          dData.push_back( aux );
-    aux.sSig1 = "[[[]]]";                      aux.sSig2 = "[[]]";                         dData.push_back( aux );
-    aux.sSig1 = "[1,[2,[3,[4,[5,6,7]]]],8,9]"; aux.sSig2 = "[1,[2,[3,[4,[5,6,0]]]],8,9]";  dData.push_back( aux );
-}
-
-// file input - this function reads text file content one line at a time - adapt code to match your need for line parsing!
-void ReadInputData( const string sFileName, DataStream &vData ) {
-    ifstream dataFileStream( sFileName );
-    vData.clear();
-    string sLine;
-    DatumType datum;
-    int nLineNr = 0;
-    while (getline( dataFileStream, sLine )) {
-        if (sLine.length() > 0) {    // non empty line
-            nLineNr += 1;
-            switch (nLineNr) {
-                case  1: datum.sSig1 = sLine;                           break;
-                case  2: datum.sSig2 = sLine; vData.push_back( datum ); break;
-                default: cout << "ERROR - ReadInputData() --> unknown nLineNr: " << nLineNr << endl;
-            }
-        } else {                     // reset line number on empty lines
-            nLineNr = 0;
-        }
-    }
-    dataFileStream.close();
-}
-
-void GetData_TEST(   DataStream &dData ) { ReadInputData( "input.test.txt", dData ); }
-void GetData_PUZZLE( DataStream &dData ) { ReadInputData( "input.puzzle.txt", dData ); }
-
-// ==========   CONSOLE OUTPUT FUNCTIONS
-
-// output to console for testing
-void PrintDatum( DatumType &iData ) {
-    cout << iData.sSig1 << " " << iData.sSig2 << endl;
-}
-
-// output to console for testing
-void PrintDataStream( DataStream &dData ) {
-    for (auto &e : dData) {
-        PrintDatum( e );
-    }
-    cout << endl;
-}
-
-// ==========   PROGRAM PHASING
-
-// populates input data, by calling the appropriate input function that is associated
-// with the global program phase var
-void GetInput( DataStream &dData, bool bDisplay = false ) {
-
-    switch( glbProgPhase ) {
-        case EXAMPLE: GetData_EXAMPLE( dData ); break;
-        case TEST:    GetData_TEST(    dData ); break;
-        case PUZZLE:  GetData_PUZZLE(  dData ); break;
-        default: cout << "ERROR: GetInput() --> unknown program phase: " << glbProgPhase << endl;
-    }
-    // display to console if so desired (for debugging)
-    if (bDisplay) {
-        PrintDataStream( dData );
-    }
-}
-
-// ==========   PUZZLE SPECIFIC SOLUTIONS
-
-// Cuts of and returns the front token from "input_to_be_adapted", using "delim" as delimiter.
-// If delimiter is not found, the complete input string is passed as a token.
-// The input string becomes shorter as a result, and may even become empty
-string get_token_dlmtd( const string &delim, string &input_to_be_adapted ) {
-    size_t splitIndex = input_to_be_adapted.find( delim );
-    string token = input_to_be_adapted.substr( 0, splitIndex );
-    input_to_be_adapted = (splitIndex == string::npos) ? "" : input_to_be_adapted.substr( splitIndex + 1 );
-
-    return token;
-}
-
-// Cuts of and returns a token of size nSize from the front of input_to_be_adapted.
-// This input string becomes shorter as a result of this cut off, and may even become empty.
-string get_token_sized( const int nSize, string &input_to_be_adapted ) {
-    string token;
-    token = input_to_be_adapted.substr( 0, nSize );
-    input_to_be_adapted = (nSize == (int)string::npos) ? "" : input_to_be_adapted.substr( nSize );
-    return token;
-}
-
-// for convenience
-bool IsNumeric( char c ) { return ('0' <= c && c <= '9'); }
-
-// for convenience - create a new node using the parameters and return a pointer to it
-SignalType *CreateNode( int type, int val, SignalType *par ) {
-    SignalType *node = new SignalType;
-    node->nType = type;
-    node->nValue = val;
-    node->pParent = par;
-    return node;
-}
-
-// Parse the signal modeled in sSig, and create a tree from it.
-// The function is recursive. Using pPar you can pass a pointer of the parent of this tree
-// (use nullptr when creating from the root up).
-// NOTE - the sSig parameter is consumed by the parsing process!
-SignalType *SignalParse( string &sSig, SignalType *pPar ) {
-
-    SignalType *root = nullptr;
-    if (sSig.length() > 0) {
-        if (IsNumeric( sSig[0] )) {
-            // integer encountered - isolate string that represent it and build INTGR type node from it
-            int sLen;
-            for (sLen = 1; sLen < (int)sSig.length() && IsNumeric( sSig[sLen] ); sLen++) /* count length of numeric substring */;
-            string sInteger = get_token_sized( sLen, sSig );
-            int    nInteger = atoi( sInteger.c_str());
-            root = CreateNode( INTGR, nInteger, pPar );
-        }
-        if (sSig[0] == '[') {
-            // list encountered - isolate string that is within the matching brackets and parse it - building a LIST type node from it
-            // the function is called recursively to create the subtrees that go within the LIST type node
-            int nrLeftBrackets = 1;
-            int sLen;
-            for (sLen = 1; sLen < (int)sSig.length() && nrLeftBrackets > 0; sLen++) {
-                switch (sSig[sLen]) {
-                    case '[': nrLeftBrackets += 1; break;
-                    case ']': nrLeftBrackets -= 1; break;
-                }
-            }
-            sLen -= 2;  // compensate string length for both bracket characters
-            string sIgnore1 = get_token_sized( 1, sSig );   // remove leading '['
-            string sListToken = get_token_sized( sLen, sSig );
-            string sIgnore2 = get_token_sized( 1, sSig );   // remove trailing ']'
-
-            // now process the list node and it's children by recursive calls
-            root = CreateNode( LIST, 0, pPar );
-            while (sListToken.length() > 0) {
-
-                SignalType *pNode = SignalParse( sListToken, root );
-                root->vList.push_back( pNode );
-                if (sListToken.length() > 0 && sListToken[0] == ',')
-                    string sIgnore3 = get_token_sized( 1, sListToken );   // remove ','
-            }
-        }
-    }
-    return root;
-}
-
-void DisposeSignalTree( SignalType *tree ) {
-    for (auto &e : tree->vList) {
-        DisposeSignalTree( e );
-    }
-    delete tree;
-}
-
-// for pretty printing
-int glbIndentLevel = 0;
-void Indent() { for (int i = 0; i < glbIndentLevel; i++) { cout << " "; } }
-
-void PrintSignalTree( SignalType *tree ) {
-    if (tree != nullptr) {
-        Indent();
-        // print info on current node
-        cout << "type = " << TypeToString( tree->nType ) << ", value = " << tree->nValue << ", nr children = " << tree->vList.size() << endl;
-        // print info on children (if any)
-        glbIndentLevel += 2;
-        for (int i = 0; i < (int)tree->vList.size(); i++) {
-            PrintSignalTree( tree->vList[i] );
-        }
-        glbIndentLevel -= 2;
-    }
-}
-
-#define RIGHTORDER 0   // possible outcome (result) of a comparison
-#define WRONGORDER 1
-#define UNDECIDED  2
-
-string ResultToString( int nRes ) {
-    string sRes;
-    switch (nRes) {
-        case RIGHTORDER: sRes = "RIGHTORDER"; break;
-        case WRONGORDER: sRes = "WRONGORDER"; break;
-        case UNDECIDED : sRes = "UNDECIDED";  break;
-        default:         sRes = "UNKNOWN";
-    }
-    return sRes;
-}
-
-int CompareSignalTrees( SignalType *pLeft, SignalType *pRight ) {
-
-//compIndent(); cout << "comparing ";
-//compIndent(); PrintSignalTree( pLeft );
-//compIndent(); cout << "and       ";
-//compIndent(); PrintSignalTree( pRight );
-
-    int result;
-    if (pLeft == nullptr && pRight == nullptr) {
-        result = UNDECIDED;
-    } else if (pLeft == nullptr && pRight != nullptr) {
-        result = RIGHTORDER;
-    } else if (pLeft != nullptr && pRight == nullptr) {
-        result = WRONGORDER;
-    } else {
-        // both pointers are not nullptr, compare content
-        if (pLeft->nType == INTGR) {
-            if (pRight->nType == INTGR) {
-                // both are integers
-                if (pLeft->nValue < pRight->nValue) { result = RIGHTORDER; } else
-                if (pLeft->nValue > pRight->nValue) { result = WRONGORDER; } else
-                                                    { result = UNDECIDED;  }
-            } else {
-                // left is integer, right is list - convert left to list and compare again
-                SignalType *newNode = CreateNode( LIST, 0, nullptr );
-                newNode->vList.push_back( pLeft );
-                glbIndentLevel += 2;
-                result = CompareSignalTrees( newNode, pRight );
-                glbIndentLevel -= 2;
-
-                delete newNode;
-            }
-        } else {
-            if (pRight->nType == LIST) {
-                // both are lists
-
-                result = UNDECIDED;
-                // try to find outcome by comparing elements
-                int nCounter = 0;
-                bool bDone = false;
-                int leftListLen  = (int)pLeft->vList.size();
-                int rightListLen = (int)pRight->vList.size();
-                while (nCounter < leftListLen && nCounter < rightListLen && !bDone) {
-
-                    glbIndentLevel += 2;
-                    result = CompareSignalTrees( pLeft->vList[nCounter], pRight->vList[nCounter] );
-                    glbIndentLevel -= 2;
-
-                    if (result != UNDECIDED) {
-                        bDone = true;
-                    } else {
-                        nCounter += 1;
-                    }
-                }
-                // result could still be undecided, check the length of the lists
-                if (result == UNDECIDED) {
-                    if (leftListLen < rightListLen) {
-                        result = RIGHTORDER;
-                    } else if (leftListLen > rightListLen) {
-                        result = WRONGORDER;
-                    } else {
-                        result = UNDECIDED;
-                    }
-                }
-            } else {
-                // left is list, right is integer - convert right to list and compare again
-                SignalType *newNode = CreateNode( LIST, 0, nullptr );
-                newNode->vList.push_back( pRight );
-
-                glbIndentLevel += 2;
-                result = CompareSignalTrees( pLeft, newNode );
-                glbIndentLevel -= 2;
-
-                delete newNode;
-            }
-        }
-    }
-
-//compIndent(); cout << "result of comparison: " << result_to_string( result ) << endl;
-
-    return result;
-}
-
-// ==========   MAIN()
-
-typedef struct sPacketStruct {
-    string sSig;
-    SignalType *pSig = nullptr;
-} PacketType;
-
-int main()
-{
-    glbProgPhase = EXAMPLE;     // program phase to EXAMPLE, TEST or PUZZLE
-    flcTimer tmr;
-
-/* ========== */   tmr.StartTiming();   // ============================================vvvvv
-
-    // get input data, depending on the glbProgPhase (example, test, puzzle)
-    DataStream inputData;
-    GetInput( inputData, glbProgPhase != PUZZLE );
-    cout << "Data stats - size of data stream " << inputData.size() << endl << endl;
-
-/* ========== */   tmr.TimeReport( "Timing 0: " );   // =========================^^^^^vvvvv
-
-    // part 1 code here
-
-    // I'm using an aux string variable because the parsing "eats up" the signal string
-    // and I need it for part 2
-    string aux;
-
-    int nCumulateIndices = 0;
-    for (int i = 0; i < (int)inputData.size(); i++) {
-        DatumType &curRec = inputData[i];
-        aux = curRec.sSig1; curRec.pSig1 = SignalParse( aux, nullptr );
-        aux = curRec.sSig2; curRec.pSig2 = SignalParse( aux, nullptr );
-        int nCompRes = CompareSignalTrees( curRec.pSig1, curRec.pSig2 );
-
-        if (nCompRes == RIGHTORDER) {
-            nCumulateIndices += i + 1;
-        }
-    }
-    cout << endl << "Answer 1 - accumulated indices: " << nCumulateIndices << endl << endl;
-
-/* ========== */   tmr.TimeReport( "Timing 1: " );   // =========================^^^^^vvvvv
-
-    // part 2 code here
-
-    // get all packets into a vector, including their pointers to the packet trees that were
-    // parsed in part 1
-    vector<PacketType> vPackets;
-
-    for (int i = 0; i < (int)inputData.size(); i++) {
-
-        string sInput;
-        sInput = inputData[i].sSig1;
-        SignalType *pInput = inputData[i].pSig1;
-        vPackets.push_back( { sInput, pInput } );
-
-        sInput = inputData[i].sSig2;
-        pInput = inputData[i].pSig2;
-        vPackets.push_back( { sInput, pInput } );
-    }
-    // add the divider packets
-    string sDivider1 = "[[2]]";
-    SignalType *pInput;
-    aux = sDivider1; pInput = SignalParse( aux, nullptr );
-    vPackets.push_back( { sDivider1, pInput } );
-    string sDivider2 = "[[6]]";
-    aux = sDivider2; pInput = SignalParse( aux, nullptr );
-    vPackets.push_back( { sDivider2, pInput } );
-
-    // sort the packets vector using the compare function on the parsed signal trees
-    sort( vPackets.begin(), vPackets.end(), []( PacketType a, PacketType b ) {
-            return (CompareSignalTrees( a.pSig, b.pSig ) == RIGHTORDER);
-        }
-    );
-    // collect dividers indices
-    int nIndex1 = -1, nIndex2 = -1;
-    for (int i = 0; i < (int)vPackets.size(); i++) {
-        if (vPackets[i].sSig == sDivider1) { nIndex1 = i + 1; }
-        if (vPackets[i].sSig == sDivider2) { nIndex2 = i + 1; }
-    }
-    cout << endl << "Answer 2 - index first divider: " << nIndex1 << " index second divider: " << nIndex2 << " decoder key = " << nIndex1 * nIndex2 << endl << endl;
-
-/* ========== */   tmr.TimeReport( "Timing 2: " );   // ==============================^^^^^
-
-    return 0;
-}
+// AoC 2022 - day 13 - Distress Signal
+// ===================================
+
+// date:  2022-12-13
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "../aocRunner.h"
+#include "../flcInputFile.h"
+#include "../flcTokenizer.h"
+#include "../flcInputCache.h"
+
+using namespace std;
+
+namespace day13 {
+
+// ==========   INPUT DATA STRUCTURES          <<<<< ========== adapt to match columns of input file
+
+#define EMPTY 0    // constants for nType field of SignalType
+#define INTGR 1
+#define LIST  2
+
+string TypeToString( int type ) {
+    string result;
+    switch (type) {
+        case EMPTY: result = "EMPTY"; break;
+        case INTGR: result = "INTGR"; break;
+        case LIST : result = "LIST";  break;
+    }
+    return result;
+}
+
+typedef struct signalStruct {
+    int nType = EMPTY;                    // one of EMPTY, INTGR or LIST
+    int nValue;                           // used in case of INTGR
+    vector<struct signalStruct *> vList;  // used in case of LIST
+    struct signalStruct *pParent = nullptr;
+} SignalType;
+
+// the input data consists of 'pairs of signals' having a first and second selection
+typedef struct datumStruct {
+    string sSig1, sSig2;
+    SignalType *pSig1 = nullptr;
+    SignalType *pSig2 = nullptr;
+} DatumType;
+typedef vector<DatumType> DataStream;
+
+// for the input cache (see flcInputCache.h) - only the signal strings are cached, the trees are
+// made of pointers, so they are built again from the strings
+void flcCacheWrite( flcCacheWriter &w, const DatumType &d ) { w.Put( d.sSig1 ); w.Put( d.sSig2 ); }
+bool flcCacheRead(  flcCacheReader &r,       DatumType &d ) { return r.Get( d.sSig1 ) && r.Get( d.sSig2 ); }
+
+// ==========   INPUT DATA FUNCTIONS
+
+// hardcoded input - just to get the solution tested
+void GetData_EXAMPLE( DataStream &dData ) {
+    DatumType aux;
+    aux.sSig1 = "[1,1,3,1,1]";                 aux.sSig2 = "[1,1,5,1,1]";                  dData.push_back( aux );
+    aux.sSig1 = "[[1],[2,3,4]]";               aux.sSig2 = "[[1],4]";                      dData.push_back( aux );
+    aux.sSig1 = "[9]";                         aux.sSig2 = "[[8,7,6]]";                    dData.push_back( aux );
+    aux.sSig1 = "[[4,4],4,4]";                 aux.sSig2 = "[[4,4],4,4,4]";                dData.push_back( aux );
+    aux.sSig1 = "[7,7,7,7]";                   aux.sSig2 = "[7,7,7]";                      dData.push_back( aux );
+    aux.sSig1 = "[]";                          aux.sSig2 = "[3]";                          dData.push_back( aux );
+    aux.sSig1 = "[[[]]]";                      aux.sSig2 = "[[]]";                         dData.push_back( aux );
+    aux.sSig1 = "[1,[2,[3,[4,[5,6,7]]]],8,9]"; aux.sSig2 = "[1,[2,[3,[4,[5,6,0]]]],8,9]";  dData.push_back( aux );
+}
+
+// file input - this function reads text file content one line at a time - adapt code to match your need for line parsing!
+void ReadInputData( const string sFileName, DataStream &vData ) {
+    flcInputFile inputFile( sFileName );
+    vData.clear();
+    DatumType datum;
+    int nLineNr = 0;
+    for (auto sLine : inputFile.Lines()) {
+        if (sLine.length() > 0) {    // non empty line
+            nLineNr += 1;
+            switch (nLineNr) {
+                case  1: datum.sSig1 = sLine;                           break;
+                case  2: datum.sSig2 = sLine; vData.push_back( datum ); break;
+                default: cout << "ERROR - ReadInputData() --> unknown nLineNr: " << nLineNr << endl;
+            }
+        } else {                     // reset line number on empty lines
+            nLineNr = 0;
+        }
+    }
+}
+
+// returns a random packet: a list of up to 5 elements, that are integers or (nested) lists
+string GeneratePacket( aocRandom &rng, int nDepth ) {
+    string sResult = "[";
+    int nElts = rng.Range( 0, 5 );
+    for (int i = 0; i < nElts; i++) {
+        if (i > 0) sResult.append( "," );
+        if (nDepth < 4 && rng.Chance( 0.3 )) {
+            sResult.append( GeneratePacket( rng, nDepth + 1 ));
+        } else {
+            sResult.append( to_string( rng.Range( 0, 10 )));
+        }
+    }
+    return sResult + "]";
+}
+
+// input generator - writes nSize pairs of packets, separated by an empty line
+void GenerateInputData( ostream &os, long long nSize, aocRandom &rng ) {
+    for (long long i = 0; i < nSize; i++) {
+        os << (i == 0 ? "" : "\n");
+        os << GeneratePacket( rng, 0 ) << "\n";
+        os << GeneratePacket( rng, 0 ) << "\n";
+    }
+}
+
+// ==========   CONSOLE OUTPUT FUNCTIONS
+
+// output to console for testing
+void PrintDatum( DatumType &iData ) {
+    cout << iData.sSig1 << " " << iData.sSig2 << endl;
+}
+
+// output to console for testing
+void PrintDataStream( DataStream &dData ) {
+    for (auto &e : dData) {
+        PrintDatum( e );
+    }
+    cout << endl;
+}
+
+// ==========   PROGRAM PHASING
+
+// populates input data, by calling the appropriate input function that is associated
+// with the global program phase var
+void GetInput( DataStream &dData, eProgPhase ePhase, const string &sFileName, bool bDisplay = false ) {
+
+    switch( ePhase ) {
+        case EXAMPLE: GetData_EXAMPLE( dData ); break;
+        case TEST:
+        case PUZZLE:  ReadInputData( sFileName, dData ); break;
+        default: cout << "ERROR: GetInput() --> unknown program phase: " << ePhase << endl;
+    }
+    // display to console if so desired (for debugging)
+    if (bDisplay) {
+        PrintDataStream( dData );
+    }
+}
+
+// ==========   PUZZLE SPECIFIC SOLUTIONS
+
+// for convenience
+bool IsNumeric( char c ) { return ('0' <= c && c <= '9'); }
+
+// for convenience - create a new node using the parameters and return a pointer to it
+SignalType *CreateNode( int type, int val, SignalType *par ) {
+    SignalType *node = new SignalType;
+    node->nType = type;
+    node->nValue = val;
+    node->pParent = par;
+    return node;
+}
+
+// Parse the signal modeled in sSig, and create a tree from it.
+// The function is recursive. Using pPar you can pass a pointer of the parent of this tree
+// (use nullptr when creating from the root up).
+// NOTE - the sSig parameter is consumed by the parsing process!
+SignalType *SignalParse( flcTokenizer &sSig, SignalType *pPar ) {
+
+    SignalType *root = nullptr;
+    if (!sSig.Empty()) {
+        if (IsNumeric( sSig.Peek())) {
+            // integer encountered - build INTGR type node from it
+            root = CreateNode( INTGR, sSig.NextNumber<int>(), pPar );
+        }
+        if (sSig.Peek() == '[') {
+            // list encountered - parse the elements up to the matching bracket, building a LIST type node from it
+            // the function is called recursively to create the subtrees that go within the LIST type node
+            sSig.Skip( 1 );   // remove leading '['
+            root = CreateNode( LIST, 0, pPar );
+            while (!sSig.Empty() && sSig.Peek() != ']') {
+
+                SignalType *pNode = SignalParse( sSig, root );
+                if (pNode == nullptr) {
+                    cout << "ERROR: SignalParse() --> unexpected character: " << sSig.Peek() << endl;
+                    break;
+                }
+                root->vList.push_back( pNode );
+                sSig.SkipPrefix( "," );
+            }
+            sSig.Skip( 1 );   // remove trailing ']'
+        }
+    }
+    return root;
+}
+
+void DisposeSignalTree( SignalType *tree ) {
+    for (auto &e : tree->vList) {
+        DisposeSignalTree( e );
+    }
+    delete tree;
+}
+
+// for pretty printing
+void Indent( int nIndentLevel ) { for (int i = 0; i < nIndentLevel; i++) { cout << " "; } }
+
+void PrintSignalTree( SignalType *tree, int nIndentLevel = 0 ) {
+    if (tree != nullptr) {
+        Indent( nIndentLevel );
+        // print info on current node
+        cout << "type = " << TypeToString( tree->nType ) << ", value = " << tree->nValue << ", nr children = " << tree->vList.size() << endl;
+        // print info on children (if any)
+        for (int i = 0; i < (int)tree->vList.size(); i++) {
+            PrintSignalTree( tree->vList[i], nIndentLevel + 2 );
+        }
+    }
+}
+
+#define RIGHTORDER 0   // possible outcome (result) of a comparison
+#define WRONGORDER 1
+#define UNDECIDED  2
+
+string ResultToString( int nRes ) {
+    string sRes;
+    switch (nRes) {
+        case RIGHTORDER: sRes = "RIGHTORDER"; break;
+        case WRONGORDER: sRes = "WRONGORDER"; break;
+        case UNDECIDED : sRes = "UNDECIDED";  break;
+        default:         sRes = "UNKNOWN";
+    }
+    return sRes;
+}
+
+int CompareSignalTrees( SignalType *pLeft, SignalType *pRight ) {
+
+//compIndent(); cout << "comparing ";
+//compIndent(); PrintSignalTree( pLeft );
+//compIndent(); cout << "and       ";
+//compIndent(); PrintSignalTree( pRight );
+
+    int result;
+    if (pLeft == nullptr && pRight == nullptr) {
+        result = UNDECIDED;
+    } else if (pLeft == nullptr && pRight != nullptr) {
+        result = RIGHTORDER;
+    } else if (pLeft != nullptr && pRight == nullptr) {
+        result = WRONGORDER;
+    } else {
+        // both pointers are not nullptr, compare content
+        if (pLeft->nType == INTGR) {
+            if (pRight->nType == INTGR) {
+                // both are integers
+                if (pLeft->nValue < pRight->nValue) { result = RIGHTORDER; } else
+                if (pLeft->nValue > pRight->nValue) { result = WRONGORDER; } else
+                                                    { result = UNDECIDED;  }
+            } else {
+                // left is integer, right is list - convert left to list and compare again
+                SignalType *newNode = CreateNode( LIST, 0, nullptr );
+                newNode->vList.push_back( pLeft );
+                result = CompareSignalTrees( newNode, pRight );
+
+                delete newNode;
+            }
+        } else {
+            if (pRight->nType == LIST) {
+                // both are lists
+
+                result = UNDECIDED;
+                // try to find outcome by comparing elements
+                int nCounter = 0;
+                bool bDone = false;
+                int leftListLen  = (int)pLeft->vList.size();
+                int rightListLen = (int)pRight->vList.size();
+                while (nCounter < leftListLen && nCounter < rightListLen && !bDone) {
+
+                    result = CompareSignalTrees( pLeft->vList[nCounter], pRight->vList[nCounter] );
+
+                    if (result != UNDECIDED) {
+                        bDone = true;
+                    } else {
+                        nCounter += 1;
+                    }
+                }
+                // result could still be undecided, check the length of the lists
+                if (result == UNDECIDED) {
+                    if (leftListLen < rightListLen) {
+                        result = RIGHTORDER;
+                    } else if (leftListLen > rightListLen) {
+                        result = WRONGORDER;
+                    } else {
+                        result = UNDECIDED;
+                    }
+                }
+            } else {
+                // left is list, right is integer - convert right to list and compare again
+                SignalType *newNode = CreateNode( LIST, 0, nullptr );
+                newNode->vList.push_back( pRight );
+
+                result = CompareSignalTrees( pLeft, newNode );
+
+                delete newNode;
+            }
+        }
+    }
+
+//compIndent(); cout << "result of comparison: " << result_to_string( result ) << endl;
+
+    return result;
+}
+
+typedef struct sPacketStruct {
+    string sSig;
+    SignalType *pSig = nullptr;
+} PacketType;
+
+// ==========   RUNNER INTERFACE
+
+class Day13 : public aocDay {
+public:
+    ~Day13() {
+        for (auto &e : inputData) {
+            if (e.pSig1 != nullptr) DisposeSignalTree( e.pSig1 );
+            if (e.pSig2 != nullptr) DisposeSignalTree( e.pSig2 );
+        }
+    }
+    void GetInput( eProgPhase eRunPhase, const string &sFileName ) {
+        ePhase = eRunPhase;
+        day13::GetInput( inputData, ePhase, sFileName, ePhase != PUZZLE );
+        // parse the signal strings once - both parts only read the signal trees
+        ParseSignals();
+    }
+    size_t DataSize() { return inputData.size(); }
+    // nSize is the nr of packet pairs
+    bool GenerateInput( ostream &os, long long nSize, aocRandom &rng ) { GenerateInputData( os, nSize, rng ); return true; }
+    bool SaveCache( flcCacheWriter &writer ) { writer.Put( inputData ); return true; }
+    bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) {
+        ePhase = eRunPhase;
+        if (!reader.GetAll( inputData )) return false;
+        ParseSignals();
+        return true;
+    }
+
+// ========== part 1
+
+    string SolvePart1() {
+        int nCumulateIndices = 0;
+        for (int i = 0; i < (int)inputData.size(); i++) {
+            DatumType &curRec = inputData[i];
+            int nCompRes = CompareSignalTrees( curRec.pSig1, curRec.pSig2 );
+
+            if (nCompRes == RIGHTORDER) {
+                nCumulateIndices += i + 1;
+            }
+        }
+        return to_string( nCumulateIndices );
+    }
+
+// ========== part 2
+
+    string SolvePart2() {
+        // get all packets into a vector, including their pointers to the packet trees
+        vector<PacketType> vPackets;
+
+        for (int i = 0; i < (int)inputData.size(); i++) {
+            vPackets.push_back( { inputData[i].sSig1, inputData[i].pSig1 } );
+            vPackets.push_back( { inputData[i].sSig2, inputData[i].pSig2 } );
+        }
+        // add the divider packets
+        flcTokenizer aux;
+        string sDivider1 = "[[2]]";
+        aux = flcTokenizer( sDivider1 ); SignalType *pDivider1 = SignalParse( aux, nullptr );
+        vPackets.push_back( { sDivider1, pDivider1 } );
+        string sDivider2 = "[[6]]";
+        aux = flcTokenizer( sDivider2 ); SignalType *pDivider2 = SignalParse( aux, nullptr );
+        vPackets.push_back( { sDivider2, pDivider2 } );
+
+        // sort the packets vector using the compare function on the parsed signal trees
+        sort( vPackets.begin(), vPackets.end(), []( PacketType a, PacketType b ) {
+                return (CompareSignalTrees( a.pSig, b.pSig ) == RIGHTORDER);
+            }
+        );
+        // collect dividers indices
+        int nIndex1 = -1, nIndex2 = -1;
+        for (int i = 0; i < (int)vPackets.size(); i++) {
+            if (vPackets[i].sSig == sDivider1) { nIndex1 = i + 1; }
+            if (vPackets[i].sSig == sDivider2) { nIndex2 = i + 1; }
+        }
+        DisposeSignalTree( pDivider1 );
+        DisposeSignalTree( pDivider2 );
+
+        // the decoder key is the product of the divider indices
+        return to_string( nIndex1 * nIndex2 );
+    }
+
+private:
+    DataStream inputData;
+
+    // parses the signal strings of all the input records into signal trees (if not done already)
+    void ParseSignals() {
+        // I'm using an aux string variable because the parsing "eats up" the signal string
+        // and I need it for part 2
+        flcTokenizer aux;
+        for (auto &curRec : inputData) {
+            if (curRec.pSig1 == nullptr) { aux = flcTokenizer( curRec.sSig1 ); curRec.pSig1 = SignalParse( aux, nullptr ); }
+            if (curRec.pSig2 == nullptr) { aux = flcTokenizer( curRec.sSig2 ); curRec.pSig2 = SignalParse( aux, nullptr ); }
+        }
+    }
+};
+
+aocRegistrar registrar( 13, "Distress Signal", aocCreateDay<Day13> );
+
+} // namespace day13
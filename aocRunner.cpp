@@ -0,0 +1,1099 @@
+// AoC 2022 - multi day runner
+// ===========================
+
+// date:  2022-12-26
+// by:    Joseph21 (Joseph21-6147)
+
+// All the days are linked into one binary, and register themselves with the runner (see aocRunner.h).
+// The runner selects the days and input files from the command line, runs them in one process and
+// finishes with a single timing report. With -j the days (and independent parts) are run
+// concurrently on a pool of worker threads.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <filesystem>
+
+#include "flcTimer.h"
+#include "flcThreadPool.h"
+#include "flcParallel.h"
+#include "flcProfiler.h"
+#include "flcPerfCounters.h"
+#include "flcAllocTracker.h"
+#include "flcBenchmark.h"
+#include "flcStreamReader.h"
+#include "flcPipeline.h"
+#include "flcInputCache.h"
+#include "flcResultCache.h"
+#include "aocRunner.h"
+
+using namespace std;
+
+// ==========   DAY REGISTRATION
+
+// function static, to prevent static initialisation order problems with the registrars in the day files
+vector<aocDayInfo> &aocDayRegistry() {
+    static vector<aocDayInfo> vRegistry;
+    return vRegistry;
+}
+
+aocRegistrar::aocRegistrar( int nDay, const string &sName, aocDayFactory fCreate ) {
+    aocDayRegistry().push_back( { nDay, sName, fCreate } );
+}
+
+// ==========   COMMAND LINE
+
+typedef struct sRunnerOptions {
+    eProgPhase      ePhase = PUZZLE;
+    string          sInputDir = ".";     // directory containing the day folders
+    vector<int>     vDays;               // empty means: all registered days
+    map<int,string> mInputFiles;         // explicit input file per day
+    map<int,string> mBatchInputs;        // batch mode: the input files per day (directory, @list file or comma separated files)
+    int             nThreads = -1;       // -1 means: run sequentially, 0 means: nr of hardware threads
+    int             nLoopThreads = 0;    // threads for the parallel loops inside the days, 0 means: nr of hardware threads
+    bool            bProfile = false;    // print the zone profile report at the end
+    bool            bStream = false;     // solve in streaming mode, for the days that support it
+    bool            bPipeline = false;   // solve in pipelined mode, for the days that support it
+    bool            bCounters = false;   // add the hardware counters to the zone profile report
+    bool            bAllocs = false;     // print the allocation report at the end
+    int             nBenchReps = 0;      // > 0 means: benchmark each step this many times
+    int             nWarmUp = 3;         // nr of unrecorded benchmark runs per step
+    string          sOutputFile;         // write the timing records to this file (.json or .csv)
+    string          sBaselineFile;       // compare the timing records against this file
+    double          dThresholdPerc = 10.0;  // regression threshold for the baseline comparison
+    long long       nGenSize = 0;        // > 0 means: generate input files of this size instead of solving
+    unsigned long long nSeed = 1;        // seed for the input generators
+    string          sInputName;          // name of the input file in the day folders (empty means: depends on phase)
+    string          sCacheDir;           // directory for the binary cache of the parsed inputs (empty means: no cache)
+    string          sResultsDir;         // directory for the cache of the answers (empty means: no results cache)
+    bool            bVerify = false;     // solve the days anyway, and compare the answers with the results cache
+    string          sBuildId;            // identifies the runner binary, for the results cache (see GetBuildId())
+} RunnerOptions;
+
+void PrintUsage( const string &sProgName ) {
+    cout << "usage: " << sProgName << " [options]" << endl;
+    cout << "  -d <list>        days to run, e.g. \"1,3,5-8\" (default: all registered days)" << endl;
+    cout << "  -e               example phase - use the hardcoded example data" << endl;
+    cout << "  -t               test phase - read input.test.txt instead of input.puzzle.txt" << endl;
+    cout << "  -i <dir>         directory that contains the day folders day01 .. day25 (default: .)" << endl;
+    cout << "  -f <day>=<file>  explicit input file for one day (may be repeated), - means stdin" << endl;
+    cout << "  -B <day>=<files> batch - solve many inputs of a day and print one results table. <files> is a directory" << endl;
+    cout << "                   (all files in it), @<file> (a file that lists the input files) or a comma separated list" << endl;
+    cout << "                   of files. May be repeated. The files are solved concurrently (see -j), -o writes the table" << endl;
+    cout << "  -j <n>           run days and independent parts concurrently on n threads (0: nr of hardware threads)" << endl;
+    cout << "  -P <n>           nr of threads for the parallel loops inside the days (default 0: nr of hardware threads)" << endl;
+    cout << "                   use -P 1 to run them single threaded, for deterministic benchmarking" << endl;
+    cout << "  -b <n>           benchmark - after the normal run, time each step n times and report statistics" << endl;
+    cout << "  -w <n>           nr of warm-up runs per step before the benchmark samples are taken (default: 3)" << endl;
+    cout << "  -o <file>        write the timing records to file, as JSON if it ends in .json, otherwise as CSV" << endl;
+    cout << "  -c <file>        compare the timing records against a baseline file written with -o" << endl;
+    cout << "  -r <perc>        regression threshold in percent for -c (default: 10)" << endl;
+    cout << "  -g <size>        generate a synthetic input file of the given size for each selected day, and don't solve" << endl;
+    cout << "  -s <seed>        seed for the input generators (default: 1)" << endl;
+    cout << "  -n <name>        name of the input file in the day folders (default: input.puzzle.txt, with -g: input.gen.txt)" << endl;
+    cout << "  -C <dir>         cache the parsed inputs in dir, and load them from there if the input file didn't change" << endl;
+    cout << "  -M <dir>         results cache - days whose answers for this input are in dir (from the same build of the" << endl;
+    cout << "                   runner) are not solved again, their cached answers and timings are reported instead" << endl;
+    cout << "  -V               verify - with -M, solve all days and compare the answers with the cached ones (exit code 3 if" << endl;
+    cout << "                   any differ)" << endl;
+    cout << "  -S               streaming - solve both parts in one pass over the input, in constant memory (days 1, 2, 3, 4, 6, 10)" << endl;
+    cout << "  -L               pipelined - read, parse and solve on three threads, in constant memory (days 1, 2, 3, 4, 10, 15)" << endl;
+    cout << "  -a               print the heap allocations (count, bytes, peak live bytes) per step at the end" << endl;
+    cout << "  -p               profile - print the zone profile report at the end" << endl;
+    cout << "  -H               add hardware counters (IPC, cache and branch misses) to the profile report - Linux only, implies -p" << endl;
+    cout << "  -h               show this help" << endl;
+}
+
+// parses a day list like "1,3,5-8" into vDays. Returns false on syntax errors
+bool ParseDayList( const string &sList, vector<int> &vDays ) {
+    stringstream ss( sList );
+    string sItem;
+    while (getline( ss, sItem, ',' )) {
+        size_t nDash = sItem.find( '-' );
+        int nFrom = atoi( sItem.substr( 0, nDash ).c_str());
+        int nTo   = (nDash == string::npos) ? nFrom : atoi( sItem.substr( nDash + 1 ).c_str());
+        if (nFrom < 1 || nTo < nFrom || nTo > 25) {
+            return false;
+        }
+        for (int i = nFrom; i <= nTo; i++) {
+            vDays.push_back( i );
+        }
+    }
+    return true;
+}
+
+// returns false if the program should not continue (help requested or error in arguments)
+bool ParseCommandLine( int argc, char *argv[], RunnerOptions &opts ) {
+    for (int i = 1; i < argc; i++) {
+        string sArg = argv[i];
+        bool bHasValue = (i + 1 < argc);
+
+        if (sArg == "-e") { opts.ePhase = EXAMPLE; } else
+        if (sArg == "-t") { opts.ePhase = TEST;    } else
+        if (sArg == "-p") { opts.bProfile = true;  } else
+        if (sArg == "-S") { opts.bStream  = true;  } else
+        if (sArg == "-L") { opts.bPipeline = true; } else
+        if (sArg == "-a") { opts.bAllocs  = true;  } else
+        if (sArg == "-V") { opts.bVerify  = true;  } else
+        if (sArg == "-H") { opts.bProfile = true; opts.bCounters = true; } else
+        if (sArg == "-h") { PrintUsage( argv[0] ); return false; } else
+        if (sArg == "-d" && bHasValue) {
+            if (!ParseDayList( argv[++i], opts.vDays )) {
+                cout << "ERROR: ParseCommandLine() --> invalid day list: " << argv[i] << endl;
+                return false;
+            }
+        } else
+        if (sArg == "-i" && bHasValue) {
+            opts.sInputDir = argv[++i];
+        } else
+        if ((sArg == "-j" || sArg == "-P") && bHasValue) {
+            int nValue = atoi( argv[++i] );
+            if (nValue < 0) {
+                cout << "ERROR: ParseCommandLine() --> invalid nr of threads: " << argv[i] << endl;
+                return false;
+            }
+            (sArg == "-j" ? opts.nThreads : opts.nLoopThreads) = nValue;
+        } else
+        if ((sArg == "-b" || sArg == "-w") && bHasValue) {
+            int nValue = atoi( argv[++i] );
+            if (nValue < 0 || (sArg == "-b" && nValue == 0)) {
+                cout << "ERROR: ParseCommandLine() --> invalid nr of runs: " << argv[i] << endl;
+                return false;
+            }
+            (sArg == "-b" ? opts.nBenchReps : opts.nWarmUp) = nValue;
+        } else
+        if (sArg == "-g" && bHasValue) {
+            opts.nGenSize = atoll( argv[++i] );
+            if (opts.nGenSize <= 0) {
+                cout << "ERROR: ParseCommandLine() --> invalid input size: " << argv[i] << endl;
+                return false;
+            }
+        } else
+        if (sArg == "-s" && bHasValue) { opts.nSeed = strtoull( argv[++i], nullptr, 10 ); } else
+        if (sArg == "-n" && bHasValue) { opts.sInputName = argv[++i]; } else
+        if (sArg == "-C" && bHasValue) { opts.sCacheDir  = argv[++i]; } else
+        if (sArg == "-M" && bHasValue) { opts.sResultsDir = argv[++i]; } else
+        if (sArg == "-o" && bHasValue) { opts.sOutputFile   = argv[++i]; } else
+        if (sArg == "-c" && bHasValue) { opts.sBaselineFile = argv[++i]; } else
+        if (sArg == "-r" && bHasValue) {
+            opts.dThresholdPerc = atof( argv[++i] );
+            if (opts.dThresholdPerc < 0.0) {
+                cout << "ERROR: ParseCommandLine() --> invalid threshold: " << argv[i] << endl;
+                return false;
+            }
+        } else
+        if ((sArg == "-f" || sArg == "-B") && bHasValue) {
+            string sValue = argv[++i];
+            size_t nEq = sValue.find( '=' );
+            int nDay = atoi( sValue.substr( 0, nEq ).c_str());
+            if (nEq == string::npos || nDay < 1 || nDay > 25) {
+                cout << "ERROR: ParseCommandLine() --> expected <day>=<file>, got: " << sValue << endl;
+                return false;
+            }
+            (sArg == "-f" ? opts.mInputFiles : opts.mBatchInputs)[nDay] = sValue.substr( nEq + 1 );
+        } else {
+            cout << "ERROR: ParseCommandLine() --> unknown or incomplete argument: " << sArg << endl;
+            PrintUsage( argv[0] );
+            return false;
+        }
+    }
+    if (opts.bStream && opts.bPipeline) {
+        cout << "ERROR: ParseCommandLine() --> -S and -L can't be combined" << endl;
+        return false;
+    }
+    if (opts.bVerify && opts.sResultsDir.empty()) {
+        cout << "ERROR: ParseCommandLine() --> -V needs a results cache directory (-M)" << endl;
+        return false;
+    }
+    // generated files get their own name by default, so that real inputs are never overwritten
+    if (opts.nGenSize > 0 && opts.sInputName.empty()) {
+        opts.sInputName = "input.gen.txt";
+    }
+    return true;
+}
+
+// the default input file for day 5 in puzzle phase is <input dir>/day05/input.puzzle.txt
+string InputFileName( const RunnerOptions &opts, int nDay ) {
+    auto iter = opts.mInputFiles.find( nDay );
+    if (iter != opts.mInputFiles.end()) {
+        return iter->second;
+    }
+    stringstream ss;
+    ss << opts.sInputDir << "/day" << setw( 2 ) << setfill( '0' ) << nDay << "/"
+       << (!opts.sInputName.empty() ? opts.sInputName : (opts.ePhase == TEST ? "input.test.txt" : "input.puzzle.txt"));
+    return ss.str();
+}
+
+// ==========   INPUT GENERATION
+
+// writes a generated input file for each selected day, at the place where a run with the same
+// options reads it. Returns the nr of days that failed
+int GenerateInputs( const vector<aocDayInfo> &vSelected, const RunnerOptions &opts ) {
+    int nFailures = 0;
+    for (auto &info : vSelected) {
+        unique_ptr<aocDay> pDay( info.fCreate());
+        string sFile = InputFileName( opts, info.nDay );
+        // each day gets its own random sequence, so that its input doesn't depend on the other selected days
+        aocRandom rng( opts.nSeed * 1000003ULL + info.nDay );
+
+        error_code ec;
+        filesystem::path parentDir = filesystem::path( sFile ).parent_path();
+        if (!parentDir.empty()) {
+            filesystem::create_directories( parentDir, ec );
+        }
+        ofstream outFileStream( sFile, ios::binary );
+        if (!outFileStream.is_open()) {
+            cout << "ERROR: GenerateInputs() --> can't write to file: " << sFile << endl;
+            nFailures += 1;
+            continue;
+        }
+        flcTimer tmr;
+        bool bGenerated = pDay->GenerateInput( outFileStream, opts.nGenSize, rng );
+        outFileStream.close();
+        if (bGenerated) {
+            cout << "day " << setw( 2 ) << info.nDay << ": generated " << sFile << " ("
+                 << filesystem::file_size( sFile, ec ) << " bytes) in " << fixed << setprecision( 3 ) << tmr.TimeDuration() << " msec" << endl;
+        } else {
+            cout << "ERROR: GenerateInputs() --> day " << info.nDay << " has no input generator" << endl;
+            filesystem::remove( sFile, ec );
+            nFailures += 1;
+        }
+    }
+    return nFailures;
+}
+
+// ==========   INPUT CACHE
+
+// Reads the input of a day. With a cache directory (-C) the parsed data stream is loaded from the
+// cache file for this input if there is one, otherwise the input is parsed and the cache file is
+// written (for the days that support it). The cache file name contains the hash of the contents of
+// the input file, so a changed input gets a new cache file. Returns true if the cache was used.
+bool GetDayInput( aocDay *pDay, int nDay, const RunnerOptions &opts, const string &sInputFile ) {
+    unsigned long long nHash = 0;
+    if (opts.sCacheDir.empty() || opts.ePhase == EXAMPLE || sInputFile == "-" || !flcHashFile( sInputFile, nHash )) {
+        pDay->GetInput( opts.ePhase, sInputFile );
+        return false;
+    }
+    stringstream ss;
+    ss << "day" << setw( 2 ) << setfill( '0' ) << nDay << "." << hex << setw( 16 ) << nHash << ".bin";
+    string sCacheFile = (filesystem::path( opts.sCacheDir ) / ss.str()).string();
+
+    flcCacheReader reader;
+    if (reader.Load( sCacheFile, nDay, nHash ) && pDay->LoadCache( opts.ePhase, reader )) {
+        return true;
+    }
+    // no (valid) cache file yet - parse the input, and write the cache file for the next run
+    pDay->GetInput( opts.ePhase, sInputFile );
+
+    flcCacheWriter writer;
+    if (pDay->SaveCache( writer )) {
+        error_code ec;
+        filesystem::create_directories( opts.sCacheDir, ec );
+        if (!writer.Save( sCacheFile, nDay, nHash )) {
+            cout << "WARNING: GetDayInput() --> can't write cache file: " << sCacheFile << endl;
+        }
+    }
+    return false;
+}
+
+// ==========   RUNNING
+
+// name of the profile zone around one step of a day, e.g. "day 12 part 2"
+string ZoneName( int nDay, const string &sStep ) {
+    return "day " + to_string( nDay ) + " " + sStep;
+}
+
+// results of running one day, to put in the timing report at the end
+typedef struct sDayResult {
+    int    nDay;
+    string sName;
+    string sInputFile;
+    size_t nDataSize = 0;
+    long long nStreamBytes = -1;     // >= 0 means: solved in streaming (or pipelined) mode
+    bool   bPipelined = false;       // true if solved in pipelined mode
+    bool   bFromCache = false;       // true if the data stream was loaded from the input cache
+    bool   bFromResults = false;     // true if the day was not solved, the answers come from the results cache
+    int    nMismatches = 0;          // nr of answers that differ from the results cache (with -V)
+    string sAnswer1, sAnswer2;
+    double dTimeInput = 0.0, dTime1 = 0.0, dTime2 = 0.0;    // in milliseconds
+    flcAllocStats allocInput, alloc1, alloc2;
+} DayResult;
+
+void PrintDayResult( const DayResult &r, const RunnerOptions &opts ) {
+    cout << "Day " << setw( 2 ) << setfill( '0' ) << r.nDay << setfill( ' ' ) << " - " << r.sName;
+    if (opts.ePhase != EXAMPLE) {
+        cout << " (input: " << r.sInputFile << ")";
+    }
+    cout << endl;
+    if (r.nStreamBytes >= 0) {
+        double dMBps = (r.dTime1 > 0.0) ? r.nStreamBytes / (r.dTime1 * 1000.0) : 0.0;
+        cout << "    Data stats - " << (r.bPipelined ? "pipelined " : "streamed ") << r.nStreamBytes << " bytes (" << fixed << setprecision( 1 ) << dMBps << " MB/s)" << endl;
+    } else if (r.bFromResults) {
+        cout << "    Data stats - not solved, answers and timings from the results cache" << endl;
+    } else {
+        cout << "    Data stats - size of data stream " << r.nDataSize << (r.bFromCache ? " (from cache)" : "") << endl;
+    }
+    cout << "    Answer 1: " << r.sAnswer1 << endl;
+    cout << "    Answer 2: " << r.sAnswer2 << endl << endl;
+}
+
+// The build id identifies the runner binary as a whole, so that a change in shared code (the flc files,
+// vector_types.h) also invalidates the cached answers: it's the version string that the build passes in
+// with -DAOC_BUILD_ID="...", or else a hash of the executable itself (recompiling unchanged code gives the
+// same binary, so the same id). Returns an empty string if the executable can't be read.
+string GetBuildId( const char *sArgv0 ) {
+#ifdef AOC_BUILD_ID
+    return AOC_BUILD_ID;
+#else
+    // on Linux /proc/self/exe is the running binary, elsewhere argv[0] is the best guess
+    error_code ec;
+    string sExe = filesystem::exists( "/proc/self/exe", ec ) ? string( "/proc/self/exe" ) : string( sArgv0 );
+    unsigned long long nHash;
+    if (!flcHashFile( sExe, nHash )) {
+        return "";
+    }
+    stringstream ss;
+    ss << "exe " << hex << setw( 16 ) << setfill( '0' ) << nHash;
+    return ss.str();
+#endif
+}
+
+// the phase as it's used in the names of the results files
+string PhaseName( eProgPhase ePhase ) {
+    return (ePhase == EXAMPLE) ? "example" : (ePhase == TEST ? "test" : "puzzle");
+}
+
+// Gets the hash of the input file of a day, for the results cache. Returns false if the results cache
+// is not used for this run: no -M, example phase (nothing worth caching) or input from stdin.
+bool GetResultsKey( const RunnerOptions &opts, const string &sInputFile, unsigned long long &nHash ) {
+    return !opts.sResultsDir.empty() && opts.ePhase != EXAMPLE && sInputFile != "-" && flcHashFile( sInputFile, nHash );
+}
+
+// If the results cache has both answers for this input and phase, from the same build of the runner, they are put
+// in result together with the timings of the run that cached them, and true is returned: the day
+// doesn't need to be solved. With -V this always returns false.
+bool GetCachedResults( const aocDayInfo &info, const RunnerOptions &opts, DayResult &result ) {
+    unsigned long long nHash;
+    flcResultEntry entry;
+    if (opts.bVerify || !GetResultsKey( opts, result.sInputFile, nHash ) ||
+        !flcLoadResults( opts.sResultsDir, info.nDay, PhaseName( opts.ePhase ), nHash, entry ) ||
+        opts.sBuildId.empty() || entry.sBuildId != opts.sBuildId || !entry.parts[0].bValid || !entry.parts[1].bValid) {
+        return false;
+    }
+    result.bFromResults = true;
+    result.sAnswer1     = entry.parts[0].sAnswer;
+    result.sAnswer2     = entry.parts[1].sAnswer;
+    result.dTimeInput   = entry.dTimeInputMs;
+    result.dTime1       = entry.parts[0].dTimeMs;
+    result.dTime2       = entry.parts[1].dTimeMs;
+    return true;
+}
+
+// After a day is solved: with -V its answers are compared with the cached ones (of any build - the
+// answer for an input doesn't depend on the build), then the results of this build are
+// written to the results cache. Returns the nr of answers that differ.
+int PutCachedResults( const aocDayInfo &info, const RunnerOptions &opts, const DayResult &result ) {
+    unsigned long long nHash;
+    if (result.bFromResults || !GetResultsKey( opts, result.sInputFile, nHash )) {
+        return 0;
+    }
+    int nMismatches = 0;
+    flcResultEntry entry;
+    if (opts.bVerify && flcLoadResults( opts.sResultsDir, info.nDay, PhaseName( opts.ePhase ), nHash, entry )) {
+        const string *pAnswers[2] = { &result.sAnswer1, &result.sAnswer2 };
+        for (int i = 0; i < 2; i++) {
+            if (entry.parts[i].bValid && entry.parts[i].sAnswer != *pAnswers[i]) {
+                cout << "ERROR: PutCachedResults() --> day " << info.nDay << " part " << i + 1 << ": answer " << *pAnswers[i]
+                     << " differs from the cached answer " << entry.parts[i].sAnswer << " (build " << entry.sBuildId << ")" << endl;
+                nMismatches += 1;
+            }
+        }
+    }
+    entry = flcResultEntry();
+    entry.sBuildId          = opts.sBuildId;
+    entry.dTimeInputMs      = result.dTimeInput;
+    entry.parts[0].bValid   = true;
+    entry.parts[0].sAnswer  = result.sAnswer1;
+    entry.parts[0].dTimeMs  = result.dTime1;
+    entry.parts[1].bValid   = true;
+    entry.parts[1].sAnswer  = result.sAnswer2;
+    entry.parts[1].dTimeMs  = result.dTime2;
+    if (!flcSaveResults( opts.sResultsDir, info.nDay, PhaseName( opts.ePhase ), nHash, entry )) {
+        cout << "WARNING: PutCachedResults() --> can't write to results cache: " << opts.sResultsDir << endl;
+    }
+    return nMismatches;
+}
+
+DayResult RunDay( const aocDayInfo &info, const RunnerOptions &opts ) {
+    DayResult result;
+    result.nDay       = info.nDay;
+    result.sName      = info.sName;
+    result.sInputFile = InputFileName( opts, info.nDay );
+    if (GetCachedResults( info, opts, result )) {
+        PrintDayResult( result, opts );
+        return result;
+    }
+
+    unique_ptr<aocDay> pDay( info.fCreate() );
+
+    flcAllocMark mark;
+    flcTimer tmr;
+    tmr.StartTiming(); // ============================================vvvvv
+
+    // the zones get the size of the data stream as their nr of records (for the misses per record)
+    flcAllocTracker::Begin( mark );
+    {
+        flcProfileZone zone( ZoneName( info.nDay, "input" ).c_str());
+        result.bFromCache = GetDayInput( pDay.get(), info.nDay, opts, result.sInputFile );
+        zone.SetRecords( pDay->DataSize());
+    }
+    result.allocInput = flcAllocTracker::End( mark );
+    result.dTimeInput = tmr.TimeDuration();    // ====================^^^^^vvvvv
+    result.nDataSize  = pDay->DataSize();
+
+    flcAllocTracker::Begin( mark );
+    { flcProfileZone zone( ZoneName( info.nDay, "part 1" ).c_str()); zone.SetRecords( result.nDataSize ); result.sAnswer1 = pDay->SolvePart1(); }
+    result.alloc1   = flcAllocTracker::End( mark );
+    result.dTime1   = tmr.TimeDuration();      // ====================^^^^^vvvvv
+
+    flcAllocTracker::Begin( mark );
+    { flcProfileZone zone( ZoneName( info.nDay, "part 2" ).c_str()); zone.SetRecords( result.nDataSize ); result.sAnswer2 = pDay->SolvePart2(); }
+    result.alloc2   = flcAllocTracker::End( mark );
+    result.dTime2   = tmr.TimeDuration();      // ====================^^^^^
+
+    result.nMismatches = PutCachedResults( info, opts, result );
+    PrintDayResult( result, opts );
+    return result;
+}
+
+// Streaming mode: the day solves both parts while it reads the input, so there's only one timing,
+// which is put in the part 1 column. Days without a streaming solver are run normally.
+DayResult StreamDay( const aocDayInfo &info, const RunnerOptions &opts ) {
+    DayResult result;
+    result.nDay       = info.nDay;
+    result.sName      = info.sName;
+    result.sInputFile = InputFileName( opts, info.nDay );
+
+    unique_ptr<aocDay> pDay( info.fCreate() );
+    flcStreamReader reader;
+    if (opts.ePhase == EXAMPLE || !reader.Open( result.sInputFile )) {
+        return RunDay( info, opts );
+    }
+    flcAllocMark mark;
+    flcAllocTracker::Begin( mark );
+    flcTimer tmr;
+    bool bStreamed;
+    { flcProfileZone zone( ZoneName( info.nDay, "stream" ).c_str()); bStreamed = pDay->SolveStreaming( reader, result.sAnswer1, result.sAnswer2 ); }
+    result.dTime1 = tmr.TimeDuration();
+    result.alloc1 = flcAllocTracker::End( mark );
+    if (!bStreamed) {
+        cout << "WARNING: StreamDay() --> day " << info.nDay << " has no streaming solver, it's run normally" << endl;
+        reader.Close();
+        return RunDay( info, opts );
+    }
+    result.nStreamBytes = reader.BytesRead();
+
+    PrintDayResult( result, opts );
+    return result;
+}
+
+// Pipelined mode: like streaming mode, the one timing of both parts is put in the part 1 column.
+// Days without a pipelined solver are run normally.
+DayResult PipelineDay( const aocDayInfo &info, const RunnerOptions &opts ) {
+    DayResult result;
+    result.nDay       = info.nDay;
+    result.sName      = info.sName;
+    result.sInputFile = InputFileName( opts, info.nDay );
+
+    unique_ptr<aocDay> pDay( info.fCreate() );
+    flcBlockReader reader;
+    if (opts.ePhase == EXAMPLE || !reader.Open( result.sInputFile )) {
+        return RunDay( info, opts );
+    }
+    flcAllocMark mark;
+    flcAllocTracker::Begin( mark );
+    flcTimer tmr;
+    bool bPipelined;
+    { flcProfileZone zone( ZoneName( info.nDay, "pipeline" ).c_str()); bPipelined = pDay->SolvePipelined( opts.ePhase, reader, result.sAnswer1, result.sAnswer2 ); }
+    result.dTime1 = tmr.TimeDuration();
+    result.alloc1 = flcAllocTracker::End( mark );
+    if (!bPipelined) {
+        cout << "WARNING: PipelineDay() --> day " << info.nDay << " has no pipelined solver, it's run normally" << endl;
+        reader.Close();
+        return RunDay( info, opts );
+    }
+    result.nStreamBytes = reader.BytesRead();
+    result.bPipelined   = true;
+
+    PrintDayResult( result, opts );
+    return result;
+}
+
+// Runs all selected days on a pool of worker threads. Per day a task reads the input, and then
+// adds the tasks for the parts: one task per part if the parts are independent, otherwise one task
+// that solves them in order. The results are printed when all tasks are done.
+void RunDaysParallel( const vector<aocDayInfo> &vSelected, const RunnerOptions &opts, vector<DayResult> &vResults ) {
+    vResults.clear();
+    vResults.resize( vSelected.size());
+    vector<unique_ptr<aocDay>> vDays( vSelected.size());
+
+    flcThreadPool pool( opts.nThreads );
+    for (int i = 0; i < (int)vSelected.size(); i++) {
+        pool.AddTask( [&, i]() {
+            const aocDayInfo &info = vSelected[i];
+            DayResult &result = vResults[i];
+            result.nDay       = info.nDay;
+            result.sName      = info.sName;
+            result.sInputFile = InputFileName( opts, info.nDay );
+            if (GetCachedResults( info, opts, result )) {
+                return;
+            }
+
+            vDays[i].reset( info.fCreate() );
+            aocDay *pDay = vDays[i].get();
+
+            // the allocations are counted per thread, so each task measures its own step
+            flcAllocMark mark;
+            flcAllocTracker::Begin( mark );
+            flcTimer tmr;
+            {
+                flcProfileZone zone( ZoneName( info.nDay, "input" ).c_str());
+                result.bFromCache = GetDayInput( pDay, info.nDay, opts, result.sInputFile );
+                zone.SetRecords( pDay->DataSize());
+            }
+            result.dTimeInput = tmr.TimeDuration();
+            result.allocInput = flcAllocTracker::End( mark );
+            result.nDataSize  = pDay->DataSize();
+
+            auto part1 = [pDay, &result]() {
+                flcProfileZone zone( ZoneName( result.nDay, "part 1" ).c_str());
+                zone.SetRecords( result.nDataSize );
+                flcAllocMark m; flcAllocTracker::Begin( m );
+                flcTimer t; result.sAnswer1 = pDay->SolvePart1(); result.dTime1 = t.TimeDuration();
+                result.alloc1 = flcAllocTracker::End( m );
+            };
+            auto part2 = [pDay, &result]() {
+                flcProfileZone zone( ZoneName( result.nDay, "part 2" ).c_str());
+                zone.SetRecords( result.nDataSize );
+                flcAllocMark m; flcAllocTracker::Begin( m );
+                flcTimer t; result.sAnswer2 = pDay->SolvePart2(); result.dTime2 = t.TimeDuration();
+                result.alloc2 = flcAllocTracker::End( m );
+            };
+            if (pDay->Part2NeedsPart1()) {
+                pool.AddTask( [=]() { part1(); part2(); } );
+            } else {
+                pool.AddTask( part1 );
+                pool.AddTask( part2 );
+            }
+        } );
+    }
+    pool.WaitAll();
+
+    for (int i = 0; i < (int)vResults.size(); i++) {
+        vResults[i].nMismatches = PutCachedResults( vSelected[i], opts, vResults[i] );
+        PrintDayResult( vResults[i], opts );
+    }
+}
+
+// dWallClock is the elapsed time for running all days. Only in the parallel run it differs
+// (substantially) from the sum of the times per day
+void PrintTimingReport( const vector<DayResult> &vResults, double dWallClock ) {
+    cout << "Timing report (msec)" << endl;
+    cout << "  day       input      part 1      part 2       total" << endl;
+
+    double dGrandTotal = 0.0;
+    cout << fixed << setprecision( 3 );
+    for (auto &r : vResults) {
+        double dTotal = r.dTimeInput + r.dTime1 + r.dTime2;
+        dGrandTotal += dTotal;
+        cout << "  " << setw( 3 ) << r.nDay
+             << setw( 12 ) << r.dTimeInput << setw( 12 ) << r.dTime1
+             << setw( 12 ) << r.dTime2     << setw( 12 ) << dTotal << endl;
+    }
+    cout << "  all" << setw( 48 ) << dGrandTotal << endl;
+    cout << "  wall clock" << setw( 41 ) << dWallClock << endl;
+}
+
+// The heap allocations per step: the nr of calls to new, the bytes requested, and the highest nr of
+// bytes that were live at the same time (above what was live when the step started)
+void PrintAllocReport( const vector<DayResult> &vResults ) {
+    cout << "Allocation report" << endl;
+    cout << "  day  step          allocs           bytes       peak live" << endl;
+
+    for (auto &r : vResults) {
+        vector<pair<string, flcAllocStats>> vSteps = { { "input", r.allocInput }, { "part 1", r.alloc1 }, { "part 2", r.alloc2 } };
+        for (auto &step : vSteps) {
+            cout << "  " << setw( 3 ) << r.nDay << "  " << left << setw( 6 ) << step.first << right
+                 << setw( 14 ) << step.second.nAllocs << setw( 16 ) << step.second.nBytes
+                 << setw( 16 ) << step.second.nPeakLive << endl;
+        }
+    }
+}
+
+// ==========   BENCHMARK
+
+// benchmark statistics of one step (input, part 1 or part 2) of a day
+typedef struct sBenchResult {
+    int           nDay;
+    string        sStep;
+    flcBenchStats stats;
+    long long     nInputBytes = 0;    // size of the input file, for the throughput (0 if not known)
+} BenchResult;
+
+// stream buffer that discards everything, to silence the days during the benchmark runs
+class NullBuffer : public streambuf {
+protected:
+    int overflow( int c ) { return c; }
+};
+
+// Each sample uses a fresh day object that reads its input again, so parts that mutate their input
+// data (like day 11 and day 14) always start from the same state. Only the step itself is timed.
+// Runs sequentially - concurrent runs would disturb each other's timing.
+void BenchmarkDay( const aocDayInfo &info, const RunnerOptions &opts, vector<BenchResult> &vBench ) {
+    string sInputFile = InputFileName( opts, info.nDay );
+    long long nInputBytes = 0;
+    if (opts.ePhase != EXAMPLE && sInputFile != "-") {
+        error_code ec;
+        uintmax_t nSize = filesystem::file_size( sInputFile, ec );
+        nInputBytes = ec ? 0 : (long long)nSize;
+    }
+
+    auto measureInput = [&]() {
+        unique_ptr<aocDay> pDay( info.fCreate() );
+        flcTimer t;
+        GetDayInput( pDay.get(), info.nDay, opts, sInputFile );
+        return t.ElapsedNs();
+    };
+    auto measurePart1 = [&]() {
+        unique_ptr<aocDay> pDay( info.fCreate() );
+        GetDayInput( pDay.get(), info.nDay, opts, sInputFile );
+        flcTimer t;
+        pDay->SolvePart1();
+        return t.ElapsedNs();
+    };
+    auto measurePart2 = [&]() {
+        unique_ptr<aocDay> pDay( info.fCreate() );
+        GetDayInput( pDay.get(), info.nDay, opts, sInputFile );
+        if (pDay->Part2NeedsPart1()) {
+            pDay->SolvePart1();
+        }
+        flcTimer t;
+        pDay->SolvePart2();
+        return t.ElapsedNs();
+    };
+
+    NullBuffer nullBuf;
+    streambuf *pOrgBuf = cout.rdbuf( &nullBuf );
+    vBench.push_back( { info.nDay, "input" , flcComputeBenchStats( flcBenchmark( opts.nWarmUp, opts.nBenchReps, measureInput )), nInputBytes } );
+    vBench.push_back( { info.nDay, "part 1", flcComputeBenchStats( flcBenchmark( opts.nWarmUp, opts.nBenchReps, measurePart1 )), nInputBytes } );
+    vBench.push_back( { info.nDay, "part 2", flcComputeBenchStats( flcBenchmark( opts.nWarmUp, opts.nBenchReps, measurePart2 )), nInputBytes } );
+    cout.rdbuf( pOrgBuf );
+}
+
+void PrintBenchmarkReport( const vector<BenchResult> &vBench, const RunnerOptions &opts ) {
+    cout << "Benchmark report (usec, " << opts.nWarmUp << " warm-up + " << opts.nBenchReps << " timed runs per step)" << endl;
+    cout << "  day  step             min      median         p90         p99      stddev        GB/s" << endl;
+
+    cout << fixed << setprecision( 3 );
+    for (auto &r : vBench) {
+        cout << "  " << setw( 3 ) << r.nDay << "  " << left << setw( 6 ) << r.sStep << right
+             << setw( 12 ) << r.stats.nMin    / 1000.0 << setw( 12 ) << r.stats.nMedian / 1000.0
+             << setw( 12 ) << r.stats.nP90    / 1000.0 << setw( 12 ) << r.stats.nP99    / 1000.0
+             << setw( 12 ) << r.stats.dStdDev / 1000.0;
+        // the throughput is the size of the input file over the median time of the step (bytes per ns = GB/s)
+        if (r.nInputBytes > 0 && r.stats.nMedian > 0) {
+            cout << setw( 12 ) << (double)r.nInputBytes / r.stats.nMedian;
+        } else {
+            cout << setw( 12 ) << "-";
+        }
+        cout << endl;
+    }
+}
+
+// ==========   TIMING RECORDS
+
+// the allocation stats of one step of a day result
+const flcAllocStats &StepAllocs( const DayResult &r, const string &sStep ) {
+    return (sStep == "input") ? r.allocInput : (sStep == "part 1") ? r.alloc1 : r.alloc2;
+}
+
+// Collects the records for the -o and -c options. If the benchmark was run its medians are used,
+// otherwise the single timings of the normal run. The nr of allocations always comes from the
+// normal run (the benchmark runs allocate the same).
+vector<flcBenchRecord> MakeRecords( const vector<DayResult> &vResults, const vector<BenchResult> &vBench ) {
+    vector<flcBenchRecord> vRecords;
+    auto findResult = [&]( int nDay ) {
+        return find_if( vResults.begin(), vResults.end(), [=]( const DayResult &r ) { return r.nDay == nDay; } );
+    };
+    if (!vBench.empty()) {
+        for (auto &b : vBench) {
+            flcBenchRecord rec;
+            rec.nDay        = b.nDay;
+            rec.sPart       = b.sStep;
+            rec.nIterations = b.stats.nSamples;
+            rec.nMedianNs   = b.stats.nMedian;
+            auto iter = findResult( b.nDay );
+            if (iter != vResults.end()) {
+                rec.nInputSize = iter->nDataSize;
+                rec.nAllocs    = StepAllocs( *iter, b.sStep ).nAllocs;
+            }
+            vRecords.push_back( rec );
+        }
+    } else {
+        for (auto &r : vResults) {
+            vector<pair<string, double>> vSteps = { { "input", r.dTimeInput }, { "part 1", r.dTime1 }, { "part 2", r.dTime2 } };
+            for (auto &step : vSteps) {
+                flcBenchRecord rec;
+                rec.nDay        = r.nDay;
+                rec.sPart       = step.first;
+                rec.nInputSize  = r.nDataSize;
+                rec.nIterations = 1;
+                rec.nMedianNs   = (long long)(step.second * 1.0e6);
+                rec.nAllocs     = StepAllocs( r, step.first ).nAllocs;
+                vRecords.push_back( rec );
+            }
+        }
+    }
+    return vRecords;
+}
+
+bool EndsWith( const string &s, const string &sSuffix ) {
+    return s.length() >= sSuffix.length() && s.compare( s.length() - sSuffix.length(), sSuffix.length(), sSuffix ) == 0;
+}
+
+// ==========   BATCH MODE
+
+// the results of one input file in batch mode
+typedef struct sBatchResult {
+    int    nDay;
+    string sInputFile;
+    bool   bRead = false;        // false if the input file can't be read
+    size_t nDataSize = 0;
+    string sAnswer1, sAnswer2;
+    double dTimeInput = 0.0, dTime1 = 0.0, dTime2 = 0.0;    // in milliseconds
+} BatchResult;
+
+// Expands the batch argument of a day into a list of input files: all regular files in a directory
+// (sorted on name), the files listed in a text file given as @<file> (one per line, empty lines
+// skipped), or a comma separated list of files.
+vector<string> BatchFiles( const string &sSpec ) {
+    vector<string> vFiles;
+    error_code ec;
+    if (filesystem::is_directory( sSpec, ec )) {
+        for (auto &entry : filesystem::directory_iterator( sSpec, ec )) {
+            if (entry.is_regular_file( ec )) {
+                vFiles.push_back( entry.path().string());
+            }
+        }
+        sort( vFiles.begin(), vFiles.end());
+    } else if (!sSpec.empty() && sSpec[0] == '@') {
+        ifstream listFileStream( sSpec.substr( 1 ));
+        if (!listFileStream.is_open()) {
+            cout << "ERROR: BatchFiles() --> can't open list file: " << sSpec.substr( 1 ) << endl;
+        }
+        string sLine;
+        while (getline( listFileStream, sLine )) {
+            if (!sLine.empty() && sLine.back() == '\r') sLine.pop_back();
+            if (!sLine.empty()) vFiles.push_back( sLine );
+        }
+    } else {
+        stringstream ss( sSpec );
+        string sItem;
+        while (getline( ss, sItem, ',' )) {
+            if (!sItem.empty()) vFiles.push_back( sItem );
+        }
+    }
+    return vFiles;
+}
+
+// Solves all input files of the batch days, each file as one task on the thread pool (so the
+// parts of one file are solved in order). The days are silenced while the batch runs - only
+// the results table is printed at the end.
+void RunBatch( const vector<aocDayInfo> &vRegistry, const RunnerOptions &opts, vector<BatchResult> &vResults ) {
+    vector<const aocDayInfo *> vInfo;
+    for (auto &batch : opts.mBatchInputs) {
+        auto iter = find_if( vRegistry.begin(), vRegistry.end(), [&]( const aocDayInfo &d ) { return d.nDay == batch.first; } );
+        if (iter == vRegistry.end()) {
+            cout << "WARNING: RunBatch() --> day " << batch.first << " is not registered, skipped" << endl;
+            continue;
+        }
+        vector<string> vFiles = BatchFiles( batch.second );
+        if (vFiles.empty()) {
+            cout << "WARNING: RunBatch() --> no input files for day " << batch.first << ": " << batch.second << endl;
+        }
+        for (auto &sFile : vFiles) {
+            BatchResult result;
+            result.nDay       = batch.first;
+            result.sInputFile = sFile;
+            vResults.push_back( result );
+            vInfo.push_back( &(*iter) );
+        }
+    }
+
+    NullBuffer nullBuf;
+    streambuf *pOrgBuf = cout.rdbuf( &nullBuf );
+    {
+        flcThreadPool pool( max( opts.nThreads, 0 ));
+        for (int i = 0; i < (int)vResults.size(); i++) {
+            pool.AddTask( [&, i]() {
+                BatchResult &result = vResults[i];
+                error_code ec;
+                result.bRead = filesystem::is_regular_file( result.sInputFile, ec );
+                if (!result.bRead) {
+                    return;
+                }
+                unique_ptr<aocDay> pDay( vInfo[i]->fCreate() );
+                flcTimer tmr;
+                GetDayInput( pDay.get(), result.nDay, opts, result.sInputFile );
+                result.dTimeInput = tmr.TimeDuration();
+                result.nDataSize  = pDay->DataSize();
+                result.sAnswer1   = pDay->SolvePart1();
+                result.dTime1     = tmr.TimeDuration();
+                result.sAnswer2   = pDay->SolvePart2();
+                result.dTime2     = tmr.TimeDuration();
+            } );
+        }
+        pool.WaitAll();
+    }
+    cout.rdbuf( pOrgBuf );
+}
+
+// multi line answers (like the picture of day 10) are put on one line, with the lines separated by '|'
+string OneLine( string sAnswer ) {
+    while (!sAnswer.empty() && sAnswer.back()  == '\n') sAnswer.pop_back();
+    while (!sAnswer.empty() && sAnswer.front() == '\n') sAnswer.erase( 0, 1 );
+    replace( sAnswer.begin(), sAnswer.end(), '\n', '|' );
+    return sAnswer;
+}
+
+void PrintBatchTable( const vector<BatchResult> &vResults, double dWallClock ) {
+    size_t nFileWidth = 10;
+    for (auto &r : vResults) {
+        nFileWidth = max( nFileWidth, r.sInputFile.length());
+    }
+    cout << "Batch results (msec)" << endl;
+    cout << "  day  " << left << setw( nFileWidth ) << "input file" << right
+         << setw( 10 ) << "size" << setw( 12 ) << "input" << setw( 12 ) << "part 1" << setw( 12 ) << "part 2"
+         << setw( 12 ) << "total" << "  answer 1 / answer 2" << endl;
+
+    cout << fixed << setprecision( 3 );
+    for (auto &r : vResults) {
+        cout << "  " << setw( 3 ) << r.nDay << "  " << left << setw( nFileWidth ) << r.sInputFile << right;
+        if (!r.bRead) {
+            cout << "  ERROR: can't read input file" << endl;
+            continue;
+        }
+        cout << setw( 10 ) << r.nDataSize
+             << setw( 12 ) << r.dTimeInput << setw( 12 ) << r.dTime1 << setw( 12 ) << r.dTime2
+             << setw( 12 ) << r.dTimeInput + r.dTime1 + r.dTime2
+             << "  " << OneLine( r.sAnswer1 ) << " / " << OneLine( r.sAnswer2 ) << endl;
+    }
+    cout << "  " << vResults.size() << " input file(s), wall clock " << dWallClock << endl;
+}
+
+// for the CSV output: a field with a comma, quote or line break in it is quoted
+string CsvField( const string &s ) {
+    if (s.find_first_of( ",\"\r\n" ) == string::npos) {
+        return s;
+    }
+    string sResult = "\"";
+    for (char c : s) {
+        sResult += (c == '"') ? "\"\"" : string( 1, c );
+    }
+    return sResult + "\"";
+}
+
+// for the JSON output: the quoted string with the special characters escaped
+string JsonString( const string &s ) {
+    string sResult = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"' : sResult += "\\\""; break;
+            case '\\': sResult += "\\\\"; break;
+            case '\n': sResult += "\\n";  break;
+            case '\r': sResult += "\\r";  break;
+            case '\t': sResult += "\\t";  break;
+            default  : sResult += c;      break;
+        }
+    }
+    return sResult + "\"";
+}
+
+// writes the results table as JSON (an array with one object per line) or as CSV (with a header line).
+// The times are in msec, for a file that can't be read the values are null (JSON) or empty (CSV)
+void WriteBatchTable( ostream &os, const vector<BatchResult> &vResults, bool bJson ) {
+    os << fixed << setprecision( 3 );
+    if (bJson) {
+        os << "[" << endl;
+        for (int i = 0; i < (int)vResults.size(); i++) {
+            const BatchResult &r = vResults[i];
+            os << "  { \"day\": " << r.nDay << ", \"input_file\": " << JsonString( r.sInputFile );
+            if (r.bRead) {
+                os << ", \"input_size\": " << r.nDataSize
+                   << ", \"answer1\": " << JsonString( r.sAnswer1 ) << ", \"answer2\": " << JsonString( r.sAnswer2 )
+                   << ", \"input_ms\": " << r.dTimeInput << ", \"part1_ms\": " << r.dTime1 << ", \"part2_ms\": " << r.dTime2;
+            } else {
+                os << ", \"input_size\": null, \"answer1\": null, \"answer2\": null"
+                   << ", \"input_ms\": null, \"part1_ms\": null, \"part2_ms\": null";
+            }
+            os << " }" << (i + 1 < (int)vResults.size() ? "," : "") << endl;
+        }
+        os << "]" << endl;
+    } else {
+        os << "day,input_file,input_size,answer1,answer2,input_ms,part1_ms,part2_ms" << endl;
+        for (auto &r : vResults) {
+            os << r.nDay << "," << CsvField( r.sInputFile ) << ",";
+            if (r.bRead) {
+                os << r.nDataSize << "," << CsvField( r.sAnswer1 ) << "," << CsvField( r.sAnswer2 ) << ","
+                   << r.dTimeInput << "," << r.dTime1 << "," << r.dTime2;
+            } else {
+                os << ",,,,,";
+            }
+            os << endl;
+        }
+    }
+}
+
+// ==========   MAIN()
+
+int main( int argc, char *argv[] )
+{
+    RunnerOptions opts;
+    if (!ParseCommandLine( argc, argv, opts )) {
+        return 1;
+    }
+    if (!opts.sResultsDir.empty()) {
+        opts.sBuildId = GetBuildId( argv[0] );
+        if (opts.sBuildId.empty()) {
+            cout << "WARNING: main() --> can't determine the build id, the cached answers won't be used (only verified with -V)" << endl;
+        }
+    }
+
+    vector<aocDayInfo> &vRegistry = aocDayRegistry();
+    sort( vRegistry.begin(), vRegistry.end(),
+        []( const aocDayInfo &a, const aocDayInfo &b ) {
+            return a.nDay < b.nDay;
+        }
+    );
+    // select the days to run - the order on the command line is kept
+    vector<aocDayInfo> vSelected;
+    if (opts.vDays.empty()) {
+        vSelected = vRegistry;
+    } else {
+        for (auto nDay : opts.vDays) {
+            auto iter = find_if( vRegistry.begin(), vRegistry.end(), [=]( const aocDayInfo &d ) { return d.nDay == nDay; } );
+            if (iter == vRegistry.end()) {
+                cout << "WARNING: main() --> day " << nDay << " is not registered, skipped" << endl;
+            } else {
+                vSelected.push_back( *iter );
+            }
+        }
+    }
+
+    if (opts.nGenSize > 0) {
+        return (GenerateInputs( vSelected, opts ) > 0) ? 1 : 0;
+    }
+    flcScheduler::SetThreads( opts.nLoopThreads );
+    if (!opts.mBatchInputs.empty()) {
+        if (opts.ePhase == EXAMPLE) {
+            cout << "ERROR: main() --> batch mode needs input files, it can't be combined with -e" << endl;
+            return 1;
+        }
+        vector<BatchResult> vBatch;
+        flcTimer tmr;
+        RunBatch( vRegistry, opts, vBatch );
+        PrintBatchTable( vBatch, tmr.TimeDuration());
+
+        if (!opts.sOutputFile.empty()) {
+            ofstream outFileStream( opts.sOutputFile );
+            if (outFileStream.is_open()) {
+                WriteBatchTable( outFileStream, vBatch, EndsWith( opts.sOutputFile, ".json" ));
+            } else {
+                cout << "ERROR: main() --> can't write to file: " << opts.sOutputFile << endl;
+            }
+        }
+        // a non zero exit code if any of the input files couldn't be read
+        bool bAllRead = all_of( vBatch.begin(), vBatch.end(), []( const BatchResult &r ) { return r.bRead; } );
+        return bAllRead ? 0 : 1;
+    }
+
+    flcProfiler::Enable( opts.bProfile );
+    if (opts.bCounters && !flcProfiler::EnableCounters( true )) {
+        cout << "WARNING: main() --> hardware counters not available (" << flcPerfCounters::Problem() << "), profiling without them" << endl << endl;
+    }
+
+    vector<DayResult> vResults;
+    flcTimer tmr;
+    if (opts.bStream) {
+        // streaming is meant for inputs that are I/O bound, so the days are not run concurrently
+        for (auto &info : vSelected) {
+            vResults.push_back( StreamDay( info, opts ));
+        }
+    } else if (opts.bPipeline) {
+        // each pipelined day uses three threads already
+        for (auto &info : vSelected) {
+            vResults.push_back( PipelineDay( info, opts ));
+        }
+    } else if (opts.nThreads < 0) {
+        for (auto &info : vSelected) {
+            vResults.push_back( RunDay( info, opts ));
+        }
+    } else {
+        RunDaysParallel( vSelected, opts, vResults );
+    }
+    PrintTimingReport( vResults, tmr.TimeDuration());
+
+    vector<BenchResult> vBench;
+    if (opts.nBenchReps > 0) {
+        for (auto &info : vSelected) {
+            BenchmarkDay( info, opts, vBench );
+        }
+        cout << endl;
+        PrintBenchmarkReport( vBench, opts );
+    }
+    if (opts.bAllocs) {
+        cout << endl;
+        PrintAllocReport( vResults );
+    }
+    if (opts.bProfile) {
+        cout << endl;
+        flcProfiler::Report();
+    }
+
+    // the machine readable output and the baseline comparison
+    int nRegressions = 0;
+    if (!opts.sOutputFile.empty() || !opts.sBaselineFile.empty()) {
+        vector<flcBenchRecord> vRecords = MakeRecords( vResults, vBench );
+        if (!opts.sOutputFile.empty()) {
+            ofstream outFileStream( opts.sOutputFile );
+            if (outFileStream.is_open()) {
+                flcWriteBenchRecords( outFileStream, vRecords, EndsWith( opts.sOutputFile, ".json" ));
+            } else {
+                cout << "ERROR: main() --> can't write to file: " << opts.sOutputFile << endl;
+            }
+        }
+        vector<flcBenchRecord> vBaseline;
+        if (!opts.sBaselineFile.empty() && flcReadBenchRecords( opts.sBaselineFile, vBaseline )) {
+            cout << endl;
+            nRegressions = flcCompareBenchRecords( vBaseline, vRecords, opts.dThresholdPerc );
+            cout << nRegressions << " regression(s) above " << setprecision( 1 ) << opts.dThresholdPerc << "%" << endl;
+        }
+    }
+
+    // a non zero exit code lets a CI job fail on regressions, or on answers that changed
+    int nMismatches = 0;
+    for (auto &r : vResults) {
+        nMismatches += r.nMismatches;
+    }
+    if (nMismatches > 0) {
+        cout << endl << nMismatches << " answer(s) differ from the results cache" << endl;
+        return 3;
+    }
+    return (nRegressions > 0) ? 2 : 0;
+}
@@ -0,0 +1,126 @@
+// AoC 2022 - multi day runner
+// ===========================
+
+// date:  2022-12-26
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef AOCRUNNER_H
+#define AOCRUNNER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <random>
+
+class flcStreamReader;
+class flcBlockReader;
+class flcCacheWriter;
+class flcCacheReader;
+
+// ==========   PROGRAM PHASING
+
+enum eProgPhase {     // what programming phase are you in - passed by the runner to each day
+    EXAMPLE = 0,
+    TEST,
+    PUZZLE
+};
+
+// ==========   INPUT GENERATION
+
+// Pseudo random numbers for the input generators. The same seed gives the same input on every
+// platform - that's why the std distributions (which are implementation defined) are not used.
+class aocRandom {
+public:
+    aocRandom( unsigned long long nSeed ) : m_rng( nSeed ) {}
+
+    // returns a number in [nMin, nMax] (both inclusive)
+    long long Range( long long nMin, long long nMax ) {
+        return nMin + (long long)(m_rng() % (unsigned long long)(nMax - nMin + 1));
+    }
+    // returns true with probability dProb
+    bool Chance( double dProb ) { return (m_rng() >> 11) * (1.0 / 9007199254740992.0) < dProb; }
+
+    // Fisher-Yates shuffle of a vector or string
+    template <class C>
+    void Shuffle( C &c ) {
+        for (int i = (int)c.size() - 1; i > 0; i--) {
+            std::swap( c[i], c[ Range( 0, i ) ] );
+        }
+    }
+
+private:
+    std::mt19937_64 m_rng;
+};
+
+// ==========   DAY INTERFACE
+
+// Each day implements this interface. The runner creates one instance per run, reads the
+// input into it and calls the parts. All state of a run lives in the instance (or in context
+// objects owned by it), so that runs can execute concurrently. Both parts return the answer
+// as a string, so that days with text answers (day 05, day 10) fit in as well.
+class aocDay {
+public:
+    virtual ~aocDay() {}
+
+    // populates the input data. For EXAMPLE phase the hardcoded data is used, and sFileName is ignored
+    virtual void GetInput( eProgPhase ePhase, const std::string &sFileName ) = 0;
+    // returns the nr of elements in the data stream - for reporting only
+    virtual size_t DataSize() = 0;
+
+    virtual std::string SolvePart1() = 0;
+    virtual std::string SolvePart2() = 0;
+
+    // Return true if SolvePart2() uses results of SolvePart1(). If false, the runner
+    // may solve both parts concurrently (see the -j option).
+    virtual bool Part2NeedsPart1() { return false; }
+
+    // Writes a valid puzzle input to os, scaled by nSize (what nSize counts is specific per day,
+    // e.g. lines, or the side of a map). Returns false if the day has no input generator.
+    virtual bool GenerateInput( std::ostream &os, long long nSize, aocRandom &rng ) { return false; }
+
+    // Streaming mode, for days that need only one forward pass over the input: both parts are solved
+    // while the records are read from reader, without building the data stream, so the memory use
+    // doesn't grow with the input size. Returns false if the day has no streaming solver.
+    virtual bool SolveStreaming( flcStreamReader &reader, std::string &sAnswer1, std::string &sAnswer2 ) { return false; }
+
+    // Pipelined mode, for days whose solution is a fold over the records of the input: like streaming,
+    // but reading, parsing and folding overlap on three threads (see flcPipeline.h). The phase is passed
+    // for days that depend on it. Returns false if the day has no pipelined solver.
+    virtual bool SolvePipelined( eProgPhase eRunPhase, flcBlockReader &reader, std::string &sAnswer1, std::string &sAnswer2 ) { return false; }
+
+    // Binary cache of the parsed input (see the -C option and flcInputCache.h). SaveCache() writes the
+    // data stream after GetInput(), LoadCache() reads it back instead of GetInput(). LoadCache() only
+    // succeeds if it read all the data, and if it fails it must leave the data stream unchanged, since
+    // the runner falls back on GetInput() then. Both return false if the day has no cache support.
+    virtual bool SaveCache( flcCacheWriter &writer ) { return false; }
+    virtual bool LoadCache( eProgPhase eRunPhase, flcCacheReader &reader ) { return false; }
+
+protected:
+    eProgPhase ePhase = PUZZLE;    // set in GetInput(). Each run has its own phase, there is no global for it
+};
+
+// ==========   DAY REGISTRATION
+
+typedef aocDay *(*aocDayFactory)();
+
+// convenience factory, to be passed to aocRegistrar
+template <class T>
+aocDay *aocCreateDay() { return new T; }
+
+typedef struct sDayInfo {
+    int           nDay;
+    std::string   sName;
+    aocDayFactory fCreate;
+} aocDayInfo;
+
+// returns the list of registered days - sorted on day number by the runner
+std::vector<aocDayInfo> &aocDayRegistry();
+
+// Each day file defines one (namespace scope) aocRegistrar object, so that the day gets
+// registered during static initialisation, before main() of the runner starts.
+class aocRegistrar {
+public:
+    aocRegistrar( int nDay, const std::string &sName, aocDayFactory fCreate );
+};
+
+#endif // AOCRUNNER_H
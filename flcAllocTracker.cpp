@@ -0,0 +1,91 @@
+// AoC 2022 - heap allocation tracker
+// ==================================
+
+// date:  2023-01-03
+// by:    Joseph21 (Joseph21-6147)
+
+#include <new>
+#include <cstdlib>
+
+#include "flcAllocTracker.h"
+
+// ==============================/ per thread counters /==============================
+
+static thread_local long long tlAllocs = 0;
+static thread_local long long tlBytes  = 0;
+static thread_local long long tlLive   = 0;
+static thread_local long long tlPeak   = 0;
+
+// the header in front of each block holds its size - 16 bytes, to keep the block aligned
+// like malloc() does
+static const size_t nHeaderSize = 16;
+
+static void *TrackedAlloc( size_t nSize ) {
+    char *pBlock = (char *)malloc( nSize + nHeaderSize );
+    if (pBlock == nullptr) {
+        return nullptr;
+    }
+    *(size_t *)pBlock = nSize;
+    tlAllocs += 1;
+    tlBytes  += nSize;
+    tlLive   += nSize;
+    if (tlLive > tlPeak) {
+        tlPeak = tlLive;
+    }
+    return pBlock + nHeaderSize;
+}
+
+// like the standard operator new: call the new handler until it succeeds, or throw
+static void *TrackedNew( size_t nSize ) {
+    void *p;
+    while ((p = TrackedAlloc( nSize )) == nullptr) {
+        std::new_handler fHandler = std::get_new_handler();
+        if (fHandler == nullptr) {
+            throw std::bad_alloc();
+        }
+        fHandler();
+    }
+    return p;
+}
+
+static void TrackedFree( void *p ) {
+    if (p != nullptr) {
+        char *pBlock = (char *)p - nHeaderSize;
+        tlLive -= *(size_t *)pBlock;
+        free( pBlock );
+    }
+}
+
+// ==============================/ replacements of global new and delete /==============================
+
+void *operator new(   size_t nSize ) { return TrackedNew( nSize ); }
+void *operator new[]( size_t nSize ) { return TrackedNew( nSize ); }
+void *operator new(   size_t nSize, const std::nothrow_t & ) noexcept { return TrackedAlloc( nSize ); }
+void *operator new[]( size_t nSize, const std::nothrow_t & ) noexcept { return TrackedAlloc( nSize ); }
+
+void operator delete(   void *p ) noexcept { TrackedFree( p ); }
+void operator delete[]( void *p ) noexcept { TrackedFree( p ); }
+void operator delete(   void *p, size_t ) noexcept { TrackedFree( p ); }
+void operator delete[]( void *p, size_t ) noexcept { TrackedFree( p ); }
+void operator delete(   void *p, const std::nothrow_t & ) noexcept { TrackedFree( p ); }
+void operator delete[]( void *p, const std::nothrow_t & ) noexcept { TrackedFree( p ); }
+
+// ==============================/ Class flcAllocTracker /==============================
+
+void flcAllocTracker::Begin( flcAllocMark &mark ) {
+    mark = { tlAllocs, tlBytes, tlLive, tlPeak };
+    // the peak of this measurement starts from the current live bytes
+    tlPeak = tlLive;
+}
+
+flcAllocStats flcAllocTracker::End( const flcAllocMark &mark ) {
+    flcAllocStats stats;
+    stats.nAllocs   = tlAllocs - mark.nAllocs;
+    stats.nBytes    = tlBytes  - mark.nBytes;
+    stats.nPeakLive = tlPeak   - mark.nLive;
+    // restore the peak of an enclosing measurement
+    if (mark.nOuterPeak > tlPeak) {
+        tlPeak = mark.nOuterPeak;
+    }
+    return stats;
+}
@@ -0,0 +1,39 @@
+// AoC 2022 - heap allocation tracker
+// ==================================
+
+// date:  2023-01-03
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCALLOCTRACKER_H
+#define FLCALLOCTRACKER_H
+
+// flcAllocTracker.cpp replaces the global operator new and delete (just linking it in is enough).
+// Each thread counts its own allocations, so there's no locking or atomics on the allocation path.
+// To know the size of a block when it's deleted, each allocation gets a small header - so a
+// tracked program uses a bit more memory (16 bytes per allocation) than an untracked one.
+// NOTE: the live bytes are counted on the thread that does the new or delete. A block that is
+//       allocated on one thread and deleted on another makes the live bytes of both threads off.
+// NOTE: the over-aligned versions of new and delete (with std::align_val_t) are not tracked.
+
+// the allocations over a measured stretch of code, on one thread
+typedef struct sAllocStats {
+    long long nAllocs   = 0;     // nr of calls to operator new
+    long long nBytes    = 0;     // total nr of bytes requested
+    long long nPeakLive = 0;     // highest nr of live bytes, above the live bytes at the start
+} flcAllocStats;
+
+// the state of the counters at the start of a measurement
+typedef struct sAllocMark {
+    long long nAllocs, nBytes, nLive, nOuterPeak;
+} flcAllocMark;
+
+class flcAllocTracker {
+public:
+    // Begin() and End() measure the allocations of the calling thread in between. Measurements
+    // may nest (the peak of the outer one includes the peak of the inner one), as long as each
+    // End() is called on the same thread as its Begin(), in reverse order.
+    static void Begin( flcAllocMark &mark );
+    static flcAllocStats End( const flcAllocMark &mark );
+};
+
+#endif // FLCALLOCTRACKER_H
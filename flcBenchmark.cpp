@@ -0,0 +1,215 @@
+// AoC 2022 - benchmark utility
+// ============================
+
+// date:  2022-12-29
+// by:    Joseph21 (Joseph21-6147)
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+
+#include "flcBenchmark.h"
+
+// ==============================/ statistics /==============================
+
+// nearest rank percentile on a sorted, non empty vector, fPerc in [0.0, 1.0]
+static long long Percentile( const std::vector<long long> &vSorted, double fPerc ) {
+    int nRank = (int)ceil( fPerc * vSorted.size());
+    return vSorted[ std::max( 0, nRank - 1 ) ];
+}
+
+flcBenchStats flcComputeBenchStats( std::vector<long long> vSamplesNs ) {
+    flcBenchStats result;
+    if (vSamplesNs.empty()) {
+        return result;
+    }
+    std::sort( vSamplesNs.begin(), vSamplesNs.end());
+
+    result.nSamples = (int)vSamplesNs.size();
+    result.nMin     = vSamplesNs.front();
+    result.nMax     = vSamplesNs.back();
+    result.nMedian  = Percentile( vSamplesNs, 0.50 );
+    result.nP90     = Percentile( vSamplesNs, 0.90 );
+    result.nP99     = Percentile( vSamplesNs, 0.99 );
+
+    double dSum = 0.0;
+    for (auto e : vSamplesNs) {
+        dSum += e;
+    }
+    result.dMean = dSum / result.nSamples;
+
+    double dSqDev = 0.0;
+    for (auto e : vSamplesNs) {
+        dSqDev += (e - result.dMean) * (e - result.dMean);
+    }
+    // sample standard deviation (n - 1), it's 0 for a single sample
+    result.dStdDev = (result.nSamples > 1) ? sqrt( dSqDev / (result.nSamples - 1)) : 0.0;
+
+    return result;
+}
+
+// ==============================/ running /==============================
+
+std::vector<long long> flcBenchmark( int nWarmUp, int nRepetitions, std::function<long long()> fMeasure ) {
+    for (int i = 0; i < nWarmUp; i++) {
+        fMeasure();
+    }
+    std::vector<long long> vSamples;
+    vSamples.reserve( std::max( 0, nRepetitions ));
+    for (int i = 0; i < nRepetitions; i++) {
+        vSamples.push_back( fMeasure());
+    }
+    return vSamples;
+}
+
+// ==============================/ machine readable records /==============================
+
+void flcWriteBenchRecords( std::ostream &os, const std::vector<flcBenchRecord> &vRecords, bool bJson ) {
+    if (bJson) {
+        os << "[" << std::endl;
+        for (int i = 0; i < (int)vRecords.size(); i++) {
+            const flcBenchRecord &r = vRecords[i];
+            os << "  { \"day\": " << r.nDay << ", \"part\": \"" << r.sPart << "\""
+               << ", \"input_size\": " << r.nInputSize << ", \"iterations\": " << r.nIterations
+               << ", \"median_ns\": " << r.nMedianNs << ", \"allocations\": ";
+            if (r.nAllocs < 0) os << "null"; else os << r.nAllocs;
+            os << " }" << (i + 1 < (int)vRecords.size() ? "," : "") << std::endl;
+        }
+        os << "]" << std::endl;
+    } else {
+        os << "day,part,input_size,iterations,median_ns,allocations" << std::endl;
+        for (auto &r : vRecords) {
+            os << r.nDay << "," << r.sPart << "," << r.nInputSize << "," << r.nIterations << "," << r.nMedianNs << ",";
+            if (r.nAllocs >= 0) os << r.nAllocs;
+            os << std::endl;
+        }
+    }
+}
+
+// returns the value for sKey in one line of JSON as written by flcWriteBenchRecords(), or "" if
+// the key is not found. String values are returned without their quotes
+static std::string JsonValue( const std::string &sLine, const std::string &sKey ) {
+    size_t nPos = sLine.find( "\"" + sKey + "\":" );
+    if (nPos == std::string::npos) {
+        return "";
+    }
+    nPos = sLine.find_first_not_of( " ", nPos + sKey.length() + 3 );
+    if (nPos == std::string::npos) {
+        return "";
+    }
+    if (sLine[nPos] == '"') {
+        size_t nEnd = sLine.find( '"', nPos + 1 );
+        return sLine.substr( nPos + 1, nEnd - nPos - 1 );
+    }
+    size_t nEnd = sLine.find_first_of( ",}", nPos );
+    std::string sValue = sLine.substr( nPos, nEnd - nPos );
+    sValue.erase( sValue.find_last_not_of( " " ) + 1 );
+    return (sValue == "null") ? "" : sValue;
+}
+
+bool flcReadBenchRecords( const std::string &sFileName, std::vector<flcBenchRecord> &vRecords ) {
+    std::ifstream dataFileStream( sFileName );
+    if (!dataFileStream.is_open()) {
+        std::cout << "ERROR: flcReadBenchRecords() --> can't open file: " << sFileName << std::endl;
+        return false;
+    }
+    vRecords.clear();
+    std::string sLine;
+    bool bJson = (dataFileStream.peek() == '[');
+    bool bHeader = !bJson;
+    while (getline( dataFileStream, sLine )) {
+        if (!sLine.empty() && sLine.back() == '\r') {
+            sLine.pop_back();
+        }
+        if (bHeader) {
+            bHeader = false;
+            continue;
+        }
+        flcBenchRecord r;
+        std::vector<std::string> vFields;
+        if (bJson) {
+            if (sLine.find( '{' ) == std::string::npos) {
+                continue;
+            }
+            for (auto &sKey : { "day", "part", "input_size", "iterations", "median_ns", "allocations" }) {
+                vFields.push_back( JsonValue( sLine, sKey ));
+            }
+        } else {
+            std::stringstream ss( sLine );
+            std::string sField;
+            while (getline( ss, sField, ',' )) {
+                vFields.push_back( sField );
+            }
+            vFields.resize( 6 );    // the allocations field may be empty at the end of the line
+        }
+        if (vFields[0].empty() || vFields[4].empty()) {
+            std::cout << "WARNING: flcReadBenchRecords() --> skipped malformed line: " << sLine << std::endl;
+            continue;
+        }
+        r.nDay        = atoi( vFields[0].c_str());
+        r.sPart       = vFields[1];
+        r.nInputSize  = (size_t)atoll( vFields[2].c_str());
+        r.nIterations = atoi( vFields[3].c_str());
+        r.nMedianNs   = atoll( vFields[4].c_str());
+        r.nAllocs     = vFields[5].empty() ? -1 : atoll( vFields[5].c_str());
+        vRecords.push_back( r );
+    }
+    return true;
+}
+
+int flcCompareBenchRecords( const std::vector<flcBenchRecord> &vBaseline, const std::vector<flcBenchRecord> &vCurrent,
+                            double dThresholdPerc, std::ostream &os ) {
+    int nRegressions = 0;
+    std::ios_base::fmtflags oldFlags = os.flags();
+    std::streamsize oldPrecision = os.precision( 1 );
+    os << std::fixed;
+
+    os << "Baseline comparison (median, usec, threshold " << dThresholdPerc << "%, for the time and the nr of allocations)" << std::endl;
+    os << "  day  part        baseline     current    change     allocs (baseline -> current)" << std::endl;
+    os << std::setprecision( 3 );
+    for (auto &cur : vCurrent) {
+        // a baseline record only counts if it was measured on an input of the same size
+        auto iter = std::find_if( vBaseline.begin(), vBaseline.end(), [&]( const flcBenchRecord &b ) {
+                return b.nDay == cur.nDay && b.sPart == cur.sPart && b.nInputSize == cur.nInputSize;
+            }
+        );
+        os << "  " << std::setw( 3 ) << cur.nDay << "  " << std::left << std::setw( 6 ) << cur.sPart << std::right;
+        if (iter == vBaseline.end()) {
+            auto iterOther = std::find_if( vBaseline.begin(), vBaseline.end(), [&]( const flcBenchRecord &b ) {
+                    return b.nDay == cur.nDay && b.sPart == cur.sPart;
+                }
+            );
+            if (iterOther != vBaseline.end()) {
+                os << std::setw( 14 ) << iterOther->nMedianNs / 1000.0 << std::setw( 12 ) << cur.nMedianNs / 1000.0
+                   << "    (input size changed: " << iterOther->nInputSize << " -> " << cur.nInputSize << ")" << std::endl;
+                continue;
+            }
+        }
+        if (iter == vBaseline.end() || iter->nMedianNs <= 0) {
+            os << std::setw( 14 ) << "-" << std::setw( 12 ) << cur.nMedianNs / 1000.0 << "    (not in baseline)" << std::endl;
+            continue;
+        }
+        double dChange = 100.0 * (cur.nMedianNs - iter->nMedianNs) / iter->nMedianNs;
+        os << std::setw( 14 ) << iter->nMedianNs / 1000.0 << std::setw( 12 ) << cur.nMedianNs / 1000.0
+           << std::setw( 9 ) << std::showpos << std::setprecision( 1 ) << dChange << "%" << std::noshowpos << std::setprecision( 3 );
+        if (dChange > dThresholdPerc) {
+            os << "  REGRESSION";
+            nRegressions += 1;
+        }
+        // the allocations are compared only if both runs counted them
+        if (iter->nAllocs >= 0 && cur.nAllocs >= 0) {
+            os << "     " << iter->nAllocs << " -> " << cur.nAllocs;
+            if (cur.nAllocs > iter->nAllocs && 100.0 * (cur.nAllocs - iter->nAllocs) > dThresholdPerc * iter->nAllocs) {
+                os << "  ALLOC REGRESSION";
+                nRegressions += 1;
+            }
+        }
+        os << std::endl;
+    }
+    os.flags( oldFlags );
+    os.precision( oldPrecision );
+
+    return nRegressions;
+}
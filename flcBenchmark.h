@@ -0,0 +1,65 @@
+// AoC 2022 - benchmark utility
+// ============================
+
+// date:  2022-12-29
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCBENCHMARK_H
+#define FLCBENCHMARK_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+
+// A single timing sample of a sub-millisecond part is mostly noise. flcBenchmark() runs a
+// measurement a number of times after some warm-up runs, and the samples are summarized in
+// order statistics, which are robust against the occasional outlier (scheduler, page faults).
+
+// summary of a series of timing samples - all times in nanoseconds
+typedef struct sBenchStats {
+    int       nSamples = 0;
+    long long nMin     = 0;
+    long long nMedian  = 0;
+    long long nP90     = 0;
+    long long nP99     = 0;
+    long long nMax     = 0;
+    double    dMean    = 0.0;
+    double    dStdDev  = 0.0;
+} flcBenchStats;
+
+// calculates the statistics over the samples (percentiles use the nearest rank method)
+flcBenchStats flcComputeBenchStats( std::vector<long long> vSamplesNs );
+
+// Calls fMeasure nWarmUp times without recording, and then nRepetitions times recording the
+// returned value. fMeasure does its own setup (e.g. reading fresh input) and returns the time
+// in ns of only the part that is to be measured.
+std::vector<long long> flcBenchmark( int nWarmUp, int nRepetitions, std::function<long long()> fMeasure );
+
+// ==============================/ machine readable records /==============================
+
+// One record per measured step, for CI dashboards and for comparing against a baseline.
+// nAllocs is -1 if the nr of allocations is not known.
+typedef struct sBenchRecord {
+    int         nDay        = 0;
+    std::string sPart;                 // "input", "part 1" or "part 2"
+    size_t      nInputSize  = 0;
+    int         nIterations = 0;
+    long long   nMedianNs   = 0;
+    long long   nAllocs     = -1;
+} flcBenchRecord;
+
+// Writes the records as JSON (an array with one object per line) or as CSV (with a header line)
+void flcWriteBenchRecords( std::ostream &os, const std::vector<flcBenchRecord> &vRecords, bool bJson );
+// Reads records from a file written by flcWriteBenchRecords(), the format is detected from the
+// first character. Returns false if the file can't be read.
+bool flcReadBenchRecords( const std::string &sFileName, std::vector<flcBenchRecord> &vRecords );
+
+// Compares the medians of vCurrent against the records for the same day, part and input size in vBaseline,
+// and reports each of them. The nr of allocations is compared as well, if it's known in both. A record
+// whose baseline was measured on an input of another size is reported as such, but not as a regression.
+// Returns the nr of regressions of more than dThresholdPerc percent (in time or in allocations).
+int flcCompareBenchRecords( const std::vector<flcBenchRecord> &vBaseline, const std::vector<flcBenchRecord> &vCurrent,
+                            double dThresholdPerc, std::ostream &os = std::cout );
+
+#endif // FLCBENCHMARK_H
@@ -0,0 +1,231 @@
+// AoC 2022 - flat hash set / map of coordinates
+// =============================================
+
+// date:  2023-01-07
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCCOORDMAP_H
+#define FLCCOORDMAP_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "vector_types.h"    // vi2d and vi3d, and their packed keys
+
+// ==============================/ packed coordinate keys /==============================
+
+// Each coordinate type is packed into one 64 bit integer, that is what the set and map store and
+// compare. These are the plain packed keys of vector_types.h (see v_pack_key() there): a vi2d takes
+// 32 bits per component (so all of them fit), a vi3d takes 21 bits per component, so its components
+// must be in the range [-2^20, 2^20) - about plus or minus one million.
+template <class K> struct flcCoordKey {
+    static v_key Pack( const K &p ) { return v_pack_key( p ); }
+    static K     Unpack( v_key k )  { return v_unpack_key<K>( k ); }
+};
+
+// ==============================/ Class flcCoordMap /==============================
+
+// An open addressing hash map from coordinates to values, with linear probing. The keys, values and
+// the occupied flags are in three flat arrays, so a lookup mostly touches one or two cache lines,
+// and there's no allocation per element (unlike std::unordered_map). The table is at most half full.
+// Erase() shifts the next elements of the probe sequence back, so there are no tombstones.
+// NOTE: a pointer that is returned by Find() is valid until the next insertion or erase
+// NOTE: reading (Find(), Contains()) from several threads at once is fine, as long as no thread changes the map
+template <class K, class V>
+class flcCoordMap {
+public:
+    flcCoordMap( size_t nExpected = 0 ) { Reserve( nExpected ); }
+
+    size_t Size()  const { return m_nSize; }
+    bool   Empty() const { return m_nSize == 0; }
+
+    // makes room for nExpected elements, so that inserting them doesn't need a rehash
+    void Reserve( size_t nExpected ) {
+        size_t nCapacity = 16;
+        while (nCapacity < 2 * nExpected) {
+            nCapacity *= 2;
+        }
+        if (nCapacity > m_vKeys.size()) {
+            Rehash( nCapacity );
+        }
+    }
+    // removes all elements, but keeps the capacity
+    void Clear() {
+        std::fill( m_vUsed.begin(), m_vUsed.end(), 0 );
+        m_nSize = 0;
+    }
+
+    // returns a pointer to the value of k, nullptr if k is not in the map
+    V *Find( const K &k ) {
+        size_t nSlot;
+        return FindSlot( flcCoordKey<K>::Pack( k ), nSlot ) ? &m_vValues[nSlot] : nullptr;
+    }
+    const V *Find( const K &k ) const {
+        size_t nSlot;
+        return FindSlot( flcCoordKey<K>::Pack( k ), nSlot ) ? &m_vValues[nSlot] : nullptr;
+    }
+    bool Contains( const K &k ) const {
+        size_t nSlot;
+        return FindSlot( flcCoordKey<K>::Pack( k ), nSlot );
+    }
+    // The same for a key that is packed already. With the key arithmetic of vector_types.h the
+    // neighbours of a cell can be looked up without packing each of them:
+    //     v_key k = v_pack_key( p );
+    //     if (map.ContainsKey( k + v_pack_offset( vi2d( 0, 1 )))) ...
+    V *FindKey( v_key k ) {
+        size_t nSlot;
+        return FindSlot( k, nSlot ) ? &m_vValues[nSlot] : nullptr;
+    }
+    const V *FindKey( v_key k ) const {
+        size_t nSlot;
+        return FindSlot( k, nSlot ) ? &m_vValues[nSlot] : nullptr;
+    }
+    bool ContainsKey( v_key k ) const {
+        size_t nSlot;
+        return FindSlot( k, nSlot );
+    }
+
+    // adds k with value v. Returns false (and leaves the value alone) if k was in the map already
+    bool Insert( const K &k, const V &v ) {
+        size_t nSlot;
+        if (!Place( flcCoordKey<K>::Pack( k ), nSlot )) {
+            return false;
+        }
+        m_vValues[nSlot] = v;
+        return true;
+    }
+    // returns the value of k, after adding k with value V() if it was not in the map
+    V &operator [] ( const K &k ) {
+        size_t nSlot;
+        if (Place( flcCoordKey<K>::Pack( k ), nSlot )) {
+            m_vValues[nSlot] = V();
+        }
+        return m_vValues[nSlot];
+    }
+
+    // removes k, returns false if it was not in the map
+    bool Erase( const K &k ) {
+        size_t nSlot;
+        if (!FindSlot( flcCoordKey<K>::Pack( k ), nSlot )) {
+            return false;
+        }
+        // move the next elements of the cluster back if that brings them closer to their home slot,
+        // so that no element ends up behind an empty slot
+        size_t nMask = m_vKeys.size() - 1, nHole = nSlot;
+        for (size_t nNext = (nHole + 1) & nMask; m_vUsed[nNext]; nNext = (nNext + 1) & nMask) {
+            size_t nHome = Home( m_vKeys[nNext] );
+            // the element can move to the hole if its home is not in (nHole, nNext] (cyclically)
+            if (((nNext - nHome) & nMask) >= ((nNext - nHole) & nMask)) {
+                m_vKeys[  nHole] = m_vKeys[  nNext];
+                m_vValues[nHole] = std::move( m_vValues[nNext] );
+                nHole = nNext;
+            }
+        }
+        m_vUsed[nHole] = 0;
+        m_nSize -= 1;
+        return true;
+    }
+
+    // calls f( key, value ) for all elements, in no particular order
+    template <class F>
+    void ForEach( F f ) {
+        for (size_t i = 0; i < m_vKeys.size(); i++) {
+            if (m_vUsed[i]) {
+                f( flcCoordKey<K>::Unpack( m_vKeys[i] ), m_vValues[i] );
+            }
+        }
+    }
+
+private:
+    std::vector<v_key>         m_vKeys;
+    std::vector<V>             m_vValues;
+    std::vector<unsigned char> m_vUsed;
+    size_t                     m_nSize = 0;
+
+    // the finalizer of splitmix64 - neighbouring coordinates end up in unrelated slots
+    size_t Home( v_key k ) const {
+        k ^= k >> 30; k *= 0xbf58476d1ce4e5b9ULL;
+        k ^= k >> 27; k *= 0x94d049bb133111ebULL;
+        k ^= k >> 31;
+        return (size_t)k & (m_vKeys.size() - 1);
+    }
+
+    // true if k is present (nSlot is its slot), otherwise false (nSlot is the empty slot where it would go)
+    bool FindSlot( v_key k, size_t &nSlot ) const {
+        size_t nMask = m_vKeys.size() - 1;
+        for (nSlot = Home( k ); m_vUsed[nSlot]; nSlot = (nSlot + 1) & nMask) {
+            if (m_vKeys[nSlot] == k) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // finds or claims the slot for k - returns true if k is new
+    bool Place( v_key k, size_t &nSlot ) {
+        if (FindSlot( k, nSlot )) {
+            return false;
+        }
+        if (2 * (m_nSize + 1) > m_vKeys.size()) {
+            Rehash( 2 * m_vKeys.size());
+            FindSlot( k, nSlot );
+        }
+        m_vKeys[nSlot] = k;
+        m_vUsed[nSlot] = 1;
+        m_nSize += 1;
+        return true;
+    }
+
+    void Rehash( size_t nCapacity ) {
+        std::vector<v_key>         vOldKeys;
+        std::vector<V>             vOldValues;
+        std::vector<unsigned char> vOldUsed;
+        vOldKeys.swap( m_vKeys ); vOldValues.swap( m_vValues ); vOldUsed.swap( m_vUsed );
+
+        m_vKeys.assign(   nCapacity, 0 );
+        m_vValues.resize( nCapacity );
+        m_vUsed.assign(   nCapacity, 0 );
+        size_t nMask = nCapacity - 1;
+        for (size_t i = 0; i < vOldKeys.size(); i++) {
+            if (vOldUsed[i]) {
+                size_t nSlot = Home( vOldKeys[i] );
+                while (m_vUsed[nSlot]) {
+                    nSlot = (nSlot + 1) & nMask;
+                }
+                m_vKeys[  nSlot] = vOldKeys[i];
+                m_vValues[nSlot] = std::move( vOldValues[i] );
+                m_vUsed[  nSlot] = 1;
+            }
+        }
+    }
+};
+
+// ==============================/ Class flcCoordSet /==============================
+
+// the same, without values
+template <class K>
+class flcCoordSet {
+public:
+    flcCoordSet( size_t nExpected = 0 ) : m_map( nExpected ) {}
+
+    size_t Size()  const { return m_map.Size();  }
+    bool   Empty() const { return m_map.Empty(); }
+    void   Reserve( size_t nExpected ) { m_map.Reserve( nExpected ); }
+    void   Clear() { m_map.Clear(); }
+
+    bool Contains( const K &k ) const { return m_map.Contains( k ); }
+    bool ContainsKey( v_key k ) const { return m_map.ContainsKey( k ); }
+    // returns false if k was in the set already
+    bool Insert( const K &k ) { return m_map.Insert( k, NoValue()); }
+    bool Erase(  const K &k ) { return m_map.Erase( k ); }
+
+    template <class F>
+    void ForEach( F f ) { m_map.ForEach( [&]( const K &k, NoValue & ) { f( k ); } ); }
+
+private:
+    struct NoValue {};
+    flcCoordMap<K, NoValue> m_map;
+};
+
+#endif // FLCCOORDMAP_H
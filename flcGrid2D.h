@@ -0,0 +1,173 @@
+// AoC 2022 - dense 2D grid
+// ========================
+
+// date:  2023-01-06
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCGRID2D_H
+#define FLCGRID2D_H
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "vector_types.h"    // vi2d for the coordinates
+
+// A 2D grid of cells of type T, in one contiguous row-major block (instead of a vector of strings,
+// with an allocation per row). Optionally the grid has a border of nPadding cells around it, with
+// its own (sentinel) value. Then the cells just outside the grid can be read without any bounds
+// checks - for instance a border of walls that is higher than anything on the map stops a walk at
+// the edge by itself.
+// The coordinates run from (0, 0) to (Width() - 1, Height() - 1) for the grid itself, and from
+// -Padding() up to Width() + Padding() - 1 (and likewise for y) including the border.
+// NOTE: operator () and [] don't check the coordinates, use InBounds() / InGrid() or Get() for that
+template <class T>
+class flcGrid2D {
+public:
+    flcGrid2D() {}
+    flcGrid2D( int nWidth, int nHeight, const T &fill = T(), int nPadding = 0 ) { Init( nWidth, nHeight, fill, nPadding, fill ); }
+    flcGrid2D( int nWidth, int nHeight, const T &fill, int nPadding, const T &border ) { Init( nWidth, nHeight, fill, nPadding, border ); }
+
+    // (re)sizes the grid, sets all cells to fill and the border cells to border
+    void Init( int nWidth, int nHeight, const T &fill, int nPadding, const T &border ) {
+        m_nWidth   = std::max( nWidth,   0 );
+        m_nHeight  = std::max( nHeight,  0 );
+        m_nPadding = std::max( nPadding, 0 );
+        m_nStride  = m_nWidth + 2 * m_nPadding;
+        m_vCells.assign( (size_t)m_nStride * (m_nHeight + 2 * m_nPadding), border );
+        m_nOrigin  = (long long)m_nPadding * m_nStride + m_nPadding;
+        for (int y = 0; y < m_nHeight; y++) {
+            std::fill_n( m_vCells.begin() + Index( 0, y ), m_nWidth, fill );
+        }
+    }
+    // Builds the grid from lines of text, one row per line, each character converted to T. The
+    // width is that of the longest line, the missing cells of shorter lines are set to fill.
+    void InitFromLines( const std::vector<std::string> &vLines, const T &fill, int nPadding, const T &border ) {
+        size_t nLongest = 0;
+        for (auto &s : vLines) {
+            nLongest = std::max( nLongest, s.length());
+        }
+        Init( (int)nLongest, (int)vLines.size(), fill, nPadding, border );
+        for (int y = 0; y < m_nHeight; y++) {
+            T *pRow = Row( y );
+            for (size_t x = 0; x < vLines[y].length(); x++) {
+                pRow[x] = (T)vLines[y][x];
+            }
+        }
+    }
+
+    int  Width()   const { return m_nWidth;  }
+    int  Height()  const { return m_nHeight; }
+    int  Padding() const { return m_nPadding; }
+    vi2d Size()    const { return vi2d( m_nWidth, m_nHeight ); }
+    bool Empty()   const { return m_nWidth == 0 || m_nHeight == 0; }
+
+    // true if (x, y) is a cell of the grid itself, resp. of the grid or its border
+    bool InGrid(   int x, int y ) const { return x >= 0 && y >= 0 && x < m_nWidth && y < m_nHeight; }
+    bool InGrid(   const vi2d &p ) const { return InGrid( p.x, p.y ); }
+    bool InBounds( int x, int y ) const {
+        return x >= -m_nPadding && y >= -m_nPadding && x < m_nWidth + m_nPadding && y < m_nHeight + m_nPadding;
+    }
+    bool InBounds( const vi2d &p ) const { return InBounds( p.x, p.y ); }
+
+    // direct access (no checks) - the border cells can be addressed too
+    T       &operator () ( int x, int y )       { return m_vCells[ Index( x, y ) ]; }
+    const T &operator () ( int x, int y ) const { return m_vCells[ Index( x, y ) ]; }
+    T       &operator [] ( const vi2d &p )       { return m_vCells[ Index( p.x, p.y ) ]; }
+    const T &operator [] ( const vi2d &p ) const { return m_vCells[ Index( p.x, p.y ) ]; }
+
+    // checked read access: returns outside for anything that is not in the grid or its border
+    T Get( int x, int y, const T &outside ) const { return InBounds( x, y ) ? (*this)( x, y ) : outside; }
+    T Get( const vi2d &p, const T &outside ) const { return Get( p.x, p.y, outside ); }
+
+    // Linear cell index and the index step for a move of (dx, dy). Walking with these avoids
+    // recomputing y * stride + x for each step: Cell( Index( x, y ) + Step( 0, 1 )) is the cell below
+    long long Index( int x, int y ) const { return m_nOrigin + (long long)y * m_nStride + x; }
+    long long Step( int dx, int dy ) const { return (long long)dy * m_nStride + dx; }
+    T       &Cell( long long nIndex )       { return m_vCells[ nIndex ]; }
+    const T &Cell( long long nIndex ) const { return m_vCells[ nIndex ]; }
+    // converts a linear index back to a coordinate
+    vi2d Coord( long long nIndex ) const {
+        return vi2d( (int)(nIndex % m_nStride) - m_nPadding, (int)(nIndex / m_nStride) - m_nPadding );
+    }
+
+    // pointer to cell (0, y) - the cells of a row are contiguous (including its border cells)
+    T       *Row( int y )       { return m_vCells.data() + Index( 0, y ); }
+    const T *Row( int y ) const { return m_vCells.data() + Index( 0, y ); }
+
+    // Iteration over a row or a column of the grid itself (without the border cells), like:
+    //     for (auto &c : grid.RowCells( y )) ...
+    //     for (auto &c : grid.ColumnCells( x )) ...
+    class StridedRange {
+    public:
+        class Iterator {
+        public:
+            Iterator( T *p, long long nStep ) : m_p( p ), m_nStep( nStep ) {}
+            T        &operator *  () const { return *m_p; }
+            Iterator &operator ++ ()       { m_p += m_nStep; return *this; }
+            bool      operator != ( const Iterator &rhs ) const { return m_p != rhs.m_p; }
+        private:
+            T        *m_p;
+            long long m_nStep;
+        };
+        StridedRange( T *pFirst, long long nCount, long long nStep ) : m_pFirst( pFirst ), m_nCount( nCount ), m_nStep( nStep ) {}
+        Iterator  begin() const { return Iterator( m_pFirst, m_nStep ); }
+        Iterator  end()   const { return Iterator( m_pFirst + m_nCount * m_nStep, m_nStep ); }
+        long long size()  const { return m_nCount; }
+    private:
+        T        *m_pFirst;
+        long long m_nCount, m_nStep;
+    };
+    StridedRange RowCells(    int y ) { return StridedRange( Empty() ? nullptr : &(*this)( 0, y ), m_nWidth,  1         ); }
+    StridedRange ColumnCells( int x ) { return StridedRange( Empty() ? nullptr : &(*this)( x, 0 ), m_nHeight, m_nStride ); }
+
+    // sets all cells of the grid itself (not the border) to value
+    void Fill( const T &value ) {
+        for (int y = 0; y < m_nHeight; y++) {
+            std::fill_n( Row( y ), m_nWidth, value );
+        }
+    }
+
+    // all cells including the border, row by row
+    std::vector<T>       &Cells()       { return m_vCells; }
+    const std::vector<T> &Cells() const { return m_vCells; }
+
+private:
+    int            m_nWidth = 0, m_nHeight = 0, m_nPadding = 0;
+    int            m_nStride = 0;     // nr of cells per row, including the border cells
+    long long      m_nOrigin = 0;     // index of cell (0, 0)
+    std::vector<T> m_vCells;
+
+    template <class W, class U> friend void flcCacheWrite( W &writer, const flcGrid2D<U> &grid );
+    template <class R, class U> friend bool flcCacheRead(  R &reader,       flcGrid2D<U> &grid );
+};
+
+// Puts a grid in a flcCacheWriter (see flcInputCache.h) and gets it back. These are found by argument
+// dependent lookup, so the header doesn't have to include the cache
+template <class W, class U>
+void flcCacheWrite( W &writer, const flcGrid2D<U> &grid ) {
+    writer.Put( grid.m_nWidth ); writer.Put( grid.m_nHeight ); writer.Put( grid.m_nPadding );
+    writer.Put( grid.m_vCells );
+}
+
+template <class R, class U>
+bool flcCacheRead( R &reader, flcGrid2D<U> &grid ) {
+    int nWidth, nHeight, nPadding;
+    flcGrid2D<U> aux;
+    if (!reader.Get( nWidth ) || !reader.Get( nHeight ) || !reader.Get( nPadding ) || !reader.Get( aux.m_vCells )) {
+        return false;
+    }
+    if (nWidth < 0 || nHeight < 0 || nPadding < 0 ||
+        aux.m_vCells.size() != (size_t)(nWidth + 2 * nPadding) * (nHeight + 2 * nPadding)) {
+        return false;
+    }
+    aux.m_nWidth   = nWidth;
+    aux.m_nHeight  = nHeight;
+    aux.m_nPadding = nPadding;
+    aux.m_nStride  = nWidth + 2 * nPadding;
+    aux.m_nOrigin  = (long long)nPadding * aux.m_nStride + nPadding;
+    grid = std::move( aux );
+    return true;
+}
+
+#endif // FLCGRID2D_H
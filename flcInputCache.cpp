@@ -0,0 +1,112 @@
+// AoC 2022 - binary cache of parsed inputs
+// ========================================
+
+// date:  2023-01-04
+// by:    Joseph21 (Joseph21-6147)
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include "flcInputCache.h"
+
+// ==============================/ content hash /==============================
+
+// mixes all bits of h into all other bits (the finalizer of splitmix64)
+static unsigned long long Mix( unsigned long long h ) {
+    h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27; h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+// The file is hashed per 8 byte word, the last (partial) word is padded with zeroes. The length
+// is mixed in at the end, so that trailing zero bytes still change the hash.
+bool flcHashFile( const std::string &sFileName, unsigned long long &nHash ) {
+    // a pipe or FIFO can be read only once - that's for the day itself
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file( sFileName, ec )) {
+        return false;
+    }
+    FILE *pFile = fopen( sFileName.c_str(), "rb" );
+    if (pFile == nullptr) {
+        return false;
+    }
+    std::vector<unsigned long long> vBuf( 1 << 17 );    // 1 MB
+    unsigned long long h = 0x9e3779b97f4a7c15ULL, nLength = 0;
+    size_t nRead;
+    while ((nRead = fread( vBuf.data(), 1, vBuf.size() * sizeof( vBuf[0] ), pFile )) > 0) {
+        size_t nWords = (nRead + 7) / 8;
+        if (nRead % 8 != 0) {
+            memset( (char *)vBuf.data() + nRead, 0, nWords * 8 - nRead );
+        }
+        for (size_t i = 0; i < nWords; i++) {
+            h = (h ^ vBuf[i]) * 0x100000001b3ULL;
+            h ^= h >> 29;
+        }
+        nLength += nRead;
+    }
+    bool bOK = !ferror( pFile );
+    fclose( pFile );
+    nHash = Mix( h ^ nLength );
+    return bOK;
+}
+
+// ==============================/ cache file /==============================
+
+typedef struct sCacheHeader {
+    char               sMagic[4];     // "FLCC"
+    int                nFormat;       // FLC_CACHE_FORMAT
+    int                nDay;
+    int                nReserved;
+    unsigned long long nKey;          // hash of the input file
+    unsigned long long nPayload;      // nr of bytes of data after the header
+} CacheHeader;
+
+bool flcCacheWriter::Save( const std::string &sFileName, int nDay, unsigned long long nKey ) {
+    CacheHeader header = { { 'F', 'L', 'C', 'C' }, FLC_CACHE_FORMAT, nDay, 0, nKey, m_vBuffer.size() };
+
+    std::string sTmpName = sFileName + ".tmp";
+    FILE *pFile = fopen( sTmpName.c_str(), "wb" );
+    if (pFile == nullptr) {
+        return false;
+    }
+    bool bOK = fwrite( &header, sizeof( header ), 1, pFile ) == 1 &&
+               fwrite( m_vBuffer.data(), 1, m_vBuffer.size(), pFile ) == m_vBuffer.size();
+    bOK = (fclose( pFile ) == 0) && bOK;
+    if (bOK) {
+        bOK = (rename( sTmpName.c_str(), sFileName.c_str()) == 0);
+    }
+    if (!bOK) {
+        remove( sTmpName.c_str());
+    }
+    return bOK;
+}
+
+bool flcCacheReader::Load( const std::string &sFileName, int nDay, unsigned long long nKey ) {
+    m_vBuffer.clear();
+    m_nPos    = 0;
+    m_bFailed = true;
+
+    FILE *pFile = fopen( sFileName.c_str(), "rb" );
+    if (pFile == nullptr) {
+        return false;
+    }
+    fseek( pFile, 0, SEEK_END );
+    long nFileSize = ftell( pFile );
+    fseek( pFile, 0, SEEK_SET );
+
+    CacheHeader header;
+    bool bOK = fread( &header, sizeof( header ), 1, pFile ) == 1 &&
+               header.nPayload == (unsigned long long)nFileSize - sizeof( header ) &&
+               memcmp( header.sMagic, "FLCC", 4 ) == 0 && header.nFormat == FLC_CACHE_FORMAT &&
+               header.nDay == nDay && header.nKey == nKey;
+    if (bOK) {
+        // all the data in one read
+        m_vBuffer.resize( header.nPayload );
+        bOK = fread( m_vBuffer.data(), 1, m_vBuffer.size(), pFile ) == m_vBuffer.size();
+    }
+    fclose( pFile );
+    m_bFailed = !bOK;
+    return bOK;
+}
@@ -0,0 +1,160 @@
+// AoC 2022 - binary cache of parsed inputs
+// ========================================
+
+// date:  2023-01-04
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCINPUTCACHE_H
+#define FLCINPUTCACHE_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Bump this when the layout of the cached data of any day changes, so that the old cache files
+// are not used anymore.
+#define FLC_CACHE_FORMAT 4
+
+// 64 bit hash of the contents of a file - not cryptographic, it's only meant to notice that an
+// input file has changed. Returns false if the file can't be read, or is not a regular file.
+bool flcHashFile( const std::string &sFileName, unsigned long long &nHash );
+
+// Serializes data into a byte buffer. Trivially copyable types are copied as they are, strings,
+// vectors and deques get their nr of elements in front. For any other type (like a struct with a
+// string or vector in it) Put() calls flcCacheWrite( writer, value ), which the day defines next
+// to that struct (it's found by argument dependent lookup).
+// NOTE: the data is written in the byte order and layout of the machine, so a cache file is
+//       only valid for the program that wrote it
+class flcCacheWriter {
+public:
+    template <class T>
+    void Put( const T &t ) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            PutBytes( &t, sizeof( T ));
+        } else {
+            flcCacheWrite( *this, t );
+        }
+    }
+    void Put( const std::string &s ) { PutSize( s.size()); PutBytes( s.data(), s.size()); }
+
+    template <class T>
+    void Put( const std::vector<T> &v ) {
+        PutSize( v.size());
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            PutBytes( v.data(), v.size() * sizeof( T ));
+        } else {
+            for (auto &e : v) Put( e );
+        }
+    }
+    template <class T>
+    void Put( const std::deque<T> &d ) {
+        PutSize( d.size());
+        for (auto &e : d) Put( e );
+    }
+
+    // Writes the buffer to sFileName, behind a header with the day and the key (the hash of the
+    // input file). The file is written under a temporary name first, so a reader never sees a
+    // half written file. Returns false if it can't be written.
+    bool Save( const std::string &sFileName, int nDay, unsigned long long nKey );
+
+private:
+    void PutSize( size_t n ) { unsigned long long nSize = n; PutBytes( &nSize, sizeof( nSize )); }
+    void PutBytes( const void *p, size_t n ) {
+        const char *pc = (const char *)p;
+        m_vBuffer.insert( m_vBuffer.end(), pc, pc + n );
+    }
+
+    std::vector<char> m_vBuffer;
+};
+
+// Reads back what a flcCacheWriter wrote, with a Get() for each Put(). For the types that need
+// it Get() calls flcCacheRead( reader, value ), that returns false if the data is not valid.
+// Once a Get() fails all next ones fail too, so it's enough to check the result at the end.
+class flcCacheReader {
+public:
+    // Reads the whole file in one go and checks its header. Returns false if there's no such file,
+    // or if it's not a cache file for nDay and nKey (then the input must be parsed again).
+    bool Load( const std::string &sFileName, int nDay, unsigned long long nKey );
+
+    template <class T>
+    bool Get( T &t ) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            return GetBytes( &t, sizeof( T ));
+        } else {
+            return flcCacheRead( *this, t ) || Fail();
+        }
+    }
+    bool Get( std::string &s ) {
+        size_t n;
+        if (!GetSize( n, 1 )) return false;
+        s.assign( m_vBuffer.data() + m_nPos, n );
+        m_nPos += n;
+        return true;
+    }
+
+    template <class T>
+    bool Get( std::vector<T> &v ) {
+        size_t n;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (!GetSize( n, sizeof( T ))) return false;
+            v.resize( n );
+            return GetBytes( v.data(), n * sizeof( T ));
+        } else {
+            if (!GetSize( n, 1 )) return false;
+            v.resize( n );
+            for (auto &e : v) {
+                if (!Get( e )) return false;
+            }
+            return true;
+        }
+    }
+    template <class T>
+    bool Get( std::deque<T> &d ) {
+        size_t n;
+        if (!GetSize( n, 1 )) return false;
+        d.resize( n );
+        for (auto &e : d) {
+            if (!Get( e )) return false;
+        }
+        return true;
+    }
+
+    // true if all the data is read, without errors
+    bool AtEnd() { return !m_bFailed && m_nPos == m_vBuffer.size(); }
+
+    // Reads t as the last item of the data: t is only assigned if the data is complete and valid
+    template <class T>
+    bool GetAll( T &t ) {
+        T aux;
+        if (!Get( aux ) || !AtEnd()) return false;
+        t = std::move( aux );
+        return true;
+    }
+
+private:
+    bool Fail() { m_bFailed = true; return false; }
+    bool GetBytes( void *p, size_t n ) {
+        if (m_bFailed || m_vBuffer.size() - m_nPos < n) return Fail();
+        if (n > 0) memcpy( p, m_vBuffer.data() + m_nPos, n );
+        m_nPos += n;
+        return true;
+    }
+    // reads a nr of elements, and checks that the rest of the data can hold that many elements of
+    // (at least) nEltSize bytes - so a damaged file can't make a vector allocate huge amounts of memory
+    bool GetSize( size_t &n, size_t nEltSize ) {
+        unsigned long long nSize;
+        if (!GetBytes( &nSize, sizeof( nSize ))) return false;
+        if (nSize > (m_vBuffer.size() - m_nPos) / nEltSize) return Fail();
+        n = (size_t)nSize;
+        return true;
+    }
+
+    std::vector<char> m_vBuffer;
+    size_t            m_nPos = 0;
+    bool              m_bFailed = false;
+};
+
+#endif // FLCINPUTCACHE_H
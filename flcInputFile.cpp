@@ -0,0 +1,123 @@
+// AoC 2022 - memory mapped input file
+// ===================================
+
+// date:  2022-12-30
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#define FLC_USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "flcInputFile.h"
+
+// ==============================/ Class flcInputFile /==============================
+
+bool flcInputFile::Open( const std::string &sFileName, bool bIndexLines ) {
+    Close();
+    // "-" is stdin, which can't be mapped
+    if (sFileName == "-") {
+        m_vBuffer.assign( std::istreambuf_iterator<char>( std::cin ), std::istreambuf_iterator<char>());
+        m_pData = m_vBuffer.data();
+        m_nSize = m_vBuffer.size();
+        m_bOpen = true;
+    }
+#ifdef FLC_USE_MMAP
+    int fd = m_bOpen ? -1 : open( sFileName.c_str(), O_RDONLY );
+    if (fd >= 0) {
+        struct stat fileStat;
+        bool bStat = (fstat( fd, &fileStat ) == 0);
+        if (bStat && !S_ISREG( fileStat.st_mode )) {
+            // a pipe, FIFO or device has no size to map (fstat() gives 0) - read it from this same
+            // descriptor, because opening a FIFO a second time could miss what was written to it
+            char vChunk[1 << 16];
+            ssize_t nRead;
+            while ((nRead = read( fd, vChunk, sizeof( vChunk ))) > 0 || (nRead < 0 && errno == EINTR)) {
+                if (nRead > 0) {
+                    m_vBuffer.insert( m_vBuffer.end(), vChunk, vChunk + nRead );
+                }
+            }
+            if (nRead == 0) {
+                m_pData = m_vBuffer.data();
+                m_nSize = m_vBuffer.size();
+                m_bOpen = true;
+            } else {
+                m_vBuffer.clear();
+            }
+        } else if (bStat) {
+            m_nSize = (size_t)fileStat.st_size;
+            m_bOpen = true;
+            if (m_nSize > 0) {     // an empty file can't be mapped, but it's a valid (empty) input
+                void *pMap = mmap( nullptr, m_nSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+                if (pMap == MAP_FAILED) {
+                    m_nSize = 0;
+                    m_bOpen = false;
+                } else {
+                    madvise( pMap, m_nSize, MADV_SEQUENTIAL );
+                    m_pData   = (const char *)pMap;
+                    m_bMapped = true;
+                }
+            }
+        }
+        close( fd );
+    }
+#endif
+    // not mapped (no mmap available, or mapping failed) - read the contents into one buffer
+    if (!m_bOpen) {
+        std::ifstream dataFileStream( sFileName, std::ios::binary );
+        if (dataFileStream.is_open()) {
+            m_vBuffer.assign( std::istreambuf_iterator<char>( dataFileStream ), std::istreambuf_iterator<char>());
+            m_pData = m_vBuffer.data();
+            m_nSize = m_vBuffer.size();
+            m_bOpen = true;
+        }
+    }
+    if (!m_bOpen) {
+        std::cout << "ERROR: flcInputFile::Open() --> can't open file: " << sFileName << std::endl;
+        return false;
+    }
+    if (bIndexLines) {
+        IndexLines();
+    }
+    return true;
+}
+
+void flcInputFile::Close() {
+#ifdef FLC_USE_MMAP
+    if (m_bMapped) {
+        munmap( (void *)m_pData, m_nSize );
+    }
+#endif
+    m_pData   = nullptr;
+    m_nSize   = 0;
+    m_bOpen   = false;
+    m_bMapped = false;
+    m_vBuffer.clear();
+    m_vLines.clear();
+}
+
+void flcInputFile::IndexLines() {
+    m_vLines.clear();
+    m_vLines.reserve( std::count( m_pData, m_pData + m_nSize, '\n' ) + 1 );
+
+    size_t nStart = 0;
+    while (nStart < m_nSize) {
+        const char *pEol = (const char *)memchr( m_pData + nStart, '\n', m_nSize - nStart );
+        size_t nEnd  = (pEol == nullptr) ? m_nSize : (size_t)(pEol - m_pData);
+        size_t nNext = nEnd + 1;
+        if (nEnd > nStart && m_pData[nEnd - 1] == '\r') {
+            nEnd -= 1;
+        }
+        m_vLines.push_back( std::string_view( m_pData + nStart, nEnd - nStart ));
+        nStart = nNext;
+    }
+}
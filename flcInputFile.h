@@ -0,0 +1,55 @@
+// AoC 2022 - memory mapped input file
+// ===================================
+
+// date:  2022-12-30
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCINPUTFILE_H
+#define FLCINPUTFILE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Read only view on the contents of an input file, plus an index of its lines. On POSIX systems
+// a regular file is memory mapped, anything else (a pipe, like with <( ... ), or other platforms)
+// is read into one buffer. Either way there's no copy per line: the lines are string_views into
+// the file contents, without the line terminator ("\n" or "\r\n"). Like getline(), a last line
+// without terminator is included, and empty lines are kept.
+// The file name "-" means stdin.
+// NOTE: the views are only valid as long as the flcInputFile object is alive (and not closed)
+class flcInputFile {
+public:
+    flcInputFile() {}
+    flcInputFile( const std::string &sFileName, bool bIndexLines = true ) { Open( sFileName, bIndexLines ); }
+    ~flcInputFile() { Close(); }
+
+    flcInputFile( const flcInputFile & ) = delete;
+    flcInputFile &operator = ( const flcInputFile & ) = delete;
+
+    // Returns false (and reports an error) if the file can't be opened. Without bIndexLines only
+    // Contents() is available (Lines() is empty) - for parsers that scan the raw bytes themselves.
+    bool Open( const std::string &sFileName, bool bIndexLines = true );
+    void Close();
+    bool IsOpen() { return m_bOpen; }
+
+    // the whole file as a byte span
+    std::string_view Contents() { return std::string_view( m_pData, m_nSize ); }
+    size_t           Size()     { return m_nSize; }
+
+    int              NrLines()       { return (int)m_vLines.size(); }
+    std::string_view Line( int i )   { return m_vLines[i]; }
+    const std::vector<std::string_view> &Lines() { return m_vLines; }
+
+private:
+    void IndexLines();
+
+    const char                   *m_pData = nullptr;
+    size_t                        m_nSize = 0;
+    bool                          m_bOpen = false;
+    bool                          m_bMapped = false;   // true if m_pData is a memory mapping
+    std::vector<char>             m_vBuffer;           // holds the contents if the file is not mapped
+    std::vector<std::string_view> m_vLines;
+};
+
+#endif // FLCINPUTFILE_H
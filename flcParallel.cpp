@@ -0,0 +1,220 @@
+// AoC 2022 - work stealing parallel loops
+// =======================================
+
+// date:  2023-01-05
+// by:    Joseph21 (Joseph21-6147)
+
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+#include "flcParallel.h"
+
+// ==============================/ tasks and queues /==============================
+
+// one call of flcScheduler::Run()
+typedef struct sJob {
+    const std::function<void( long long, long long )> *pBody;
+    long long              nGrain;
+    std::atomic<long long> nRemaining;    // nr of elements that are not done yet
+} Job;
+
+// a sub range of a job
+typedef struct sTask {
+    Job      *pJob;
+    long long nBegin, nEnd;
+} Task;
+
+typedef struct sTaskQueue {
+    std::mutex       mutex;
+    std::deque<Task> tasks;
+} TaskQueue;
+
+// The queues 0 .. n-1 belong to the workers, queue n is shared by all threads from outside the
+// scheduler. The workers sleep on glbWake when there's nothing to do.
+typedef struct sSchedulerState {
+    std::mutex                              poolMutex;       // guards starting and stopping the workers
+    int                                     nWanted = 0;     // as passed to SetThreads()
+    bool                                    bStarted = false;
+    std::vector<std::thread>                vWorkers;
+    std::vector<std::unique_ptr<TaskQueue>> vQueues;
+    std::atomic<long long>                  nQueued{ 0 };    // nr of tasks in all queues together
+    std::mutex                              sleepMutex;
+    std::condition_variable                 wake;
+    bool                                    bStop = false;
+
+    ~sSchedulerState() { Stop(); }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock( sleepMutex );
+            bStop = true;
+        }
+        wake.notify_all();
+        for (auto &t : vWorkers) {
+            t.join();
+        }
+        vWorkers.clear();
+        vQueues.clear();
+        bStop    = false;
+        bStarted = false;
+    }
+} SchedulerState;
+
+static SchedulerState glbState;
+static thread_local int tlQueue = -1;    // the own queue of a worker thread, -1 for other threads
+
+static int ResolveThreads( int nThreads ) {
+    if (nThreads <= 0) {
+        nThreads = (int)std::thread::hardware_concurrency();
+    }
+    return std::max( nThreads, 1 );
+}
+
+static void Push( const Task &task ) {
+    TaskQueue &q = *glbState.vQueues[ tlQueue >= 0 ? tlQueue : (int)glbState.vQueues.size() - 1 ];
+    {
+        std::lock_guard<std::mutex> lock( q.mutex );
+        q.tasks.push_back( task );
+    }
+    glbState.nQueued += 1;
+    // take the sleep mutex, so that a worker that is about to sleep doesn't miss the wake up
+    { std::lock_guard<std::mutex> lock( glbState.sleepMutex ); }
+    glbState.wake.notify_one();
+}
+
+// A worker takes the newest task of its own queue (that's the smallest, and its data is still
+// in cache), and otherwise steals the oldest task of another queue (the largest one).
+static bool TryGetTask( Task &task ) {
+    int nQueues = (int)glbState.vQueues.size();
+    if (tlQueue >= 0) {
+        TaskQueue &q = *glbState.vQueues[tlQueue];
+        std::lock_guard<std::mutex> lock( q.mutex );
+        if (!q.tasks.empty()) {
+            task = q.tasks.back();
+            q.tasks.pop_back();
+            glbState.nQueued -= 1;
+            return true;
+        }
+    }
+    int nStart = (tlQueue >= 0) ? tlQueue + 1 : 0;
+    for (int i = 0; i < nQueues; i++) {
+        TaskQueue &q = *glbState.vQueues[ (nStart + i) % nQueues ];
+        std::lock_guard<std::mutex> lock( q.mutex );
+        if (!q.tasks.empty()) {
+            task = q.tasks.front();
+            q.tasks.pop_front();
+            glbState.nQueued -= 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+// splits off the upper halves for the other threads, until the rest is small enough to do here
+static void Execute( Task task ) {
+    while (task.nEnd - task.nBegin > task.pJob->nGrain) {
+        long long nMid = task.nBegin + (task.nEnd - task.nBegin) / 2;
+        Push( { task.pJob, nMid, task.nEnd } );
+        task.nEnd = nMid;
+    }
+    (*task.pJob->pBody)( task.nBegin, task.nEnd );
+    // NOTE: the job may be gone right after this, when it was the last part of it
+    task.pJob->nRemaining -= task.nEnd - task.nBegin;
+}
+
+static void WorkerLoop( int nQueue ) {
+    tlQueue = nQueue;
+    while (true) {
+        Task task;
+        if (TryGetTask( task )) {
+            Execute( task );
+            continue;
+        }
+        std::unique_lock<std::mutex> lock( glbState.sleepMutex );
+        glbState.wake.wait( lock, []() { return glbState.bStop || glbState.nQueued > 0; } );
+        if (glbState.bStop) {
+            return;
+        }
+    }
+}
+
+// starts the workers if that's not done yet, returns the nr of threads
+static int EnsureStarted() {
+    std::lock_guard<std::mutex> lock( glbState.poolMutex );
+    int nThreads = ResolveThreads( glbState.nWanted );
+    if (!glbState.bStarted && nThreads > 1) {
+        // the calling thread works along, so one worker less is needed
+        for (int i = 0; i < nThreads; i++) {
+            glbState.vQueues.push_back( std::make_unique<TaskQueue>());
+        }
+        for (int i = 0; i < nThreads - 1; i++) {
+            glbState.vWorkers.push_back( std::thread( WorkerLoop, i ));
+        }
+        glbState.bStarted = true;
+    }
+    return nThreads;
+}
+
+// ==============================/ Class flcScheduler /==============================
+
+void flcScheduler::SetThreads( int nThreads ) {
+    std::lock_guard<std::mutex> lock( glbState.poolMutex );
+    glbState.Stop();
+    glbState.nWanted = nThreads;
+}
+
+int flcScheduler::NrThreads() {
+    std::lock_guard<std::mutex> lock( glbState.poolMutex );
+    return ResolveThreads( glbState.nWanted );
+}
+
+void flcScheduler::Run( long long nBegin, long long nEnd, long long nGrain, const std::function<void( long long, long long )> &fBody ) {
+    if (nEnd <= nBegin) {
+        return;
+    }
+    nGrain = std::max( nGrain, 1LL );
+    if (EnsureStarted() <= 1 || nEnd - nBegin <= nGrain) {
+        for (long long nFrom = nBegin; nFrom < nEnd; nFrom += nGrain) {
+            fBody( nFrom, std::min( nFrom + nGrain, nEnd ));
+        }
+        return;
+    }
+    Job job;
+    job.pBody      = &fBody;
+    job.nGrain     = nGrain;
+    job.nRemaining = nEnd - nBegin;
+    Execute( { &job, nBegin, nEnd } );
+    // help out (with any job) until all parts of this job are done
+    while (job.nRemaining > 0) {
+        Task task;
+        if (TryGetTask( task )) {
+            Execute( task );
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// ==============================/ splitting an input /==============================
+
+std::vector<std::string_view> flcSplitLines( std::string_view sText, int nChunks ) {
+    std::vector<std::string_view> vChunks;
+    nChunks = std::max( nChunks, 1 );
+    size_t nBegin = 0;
+    for (int i = 1; i <= nChunks && nBegin < sText.size(); i++) {
+        size_t nEnd = sText.size();
+        if (i < nChunks) {
+            // move the cut to just after the line terminator at or after the target position
+            size_t nTarget = std::max( sText.size() / nChunks * i, nBegin + 1 );
+            size_t nEol    = sText.find( '\n', nTarget - 1 );
+            nEnd = (nEol == std::string_view::npos) ? sText.size() : nEol + 1;
+        }
+        vChunks.push_back( sText.substr( nBegin, nEnd - nBegin ));
+        nBegin = nEnd;
+    }
+    return vChunks;
+}
@@ -0,0 +1,74 @@
+// AoC 2022 - work stealing parallel loops
+// =======================================
+
+// date:  2023-01-05
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCPARALLEL_H
+#define FLCPARALLEL_H
+
+#include <vector>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+
+// One shared scheduler for the parallel loops inside the days. Its worker threads are started at
+// the first parallel loop, and each has its own task deque: a loop range is split in halves until
+// the halves are no larger than the grain size, a worker works on its own newest half and steals
+// the oldest (largest) halves of the others when it runs out of work. The thread that calls the
+// loop works along, so loops may be nested or started from any thread (like the runner's pool).
+// NOTE: the allocation tracker and the profiler count per thread, so the work that is done on
+//       the worker threads doesn't show up in the zone of the calling thread
+class flcScheduler {
+public:
+    // nThreads <= 0 means: nr of hardware threads. With 1 thread all loops run on the calling
+    // thread, chunk by chunk in order - for deterministic benchmarking.
+    // NOTE: don't call this while a parallel loop is running
+    static void SetThreads( int nThreads );
+    // the nr of threads that work on a loop (the workers plus the calling thread)
+    static int  NrThreads();
+
+    // Calls fBody( nFrom, nTo ) for sub ranges [nFrom, nTo) that together cover [nBegin, nEnd),
+    // each at most nGrain elements long. Returns when all of them are done.
+    static void Run( long long nBegin, long long nEnd, long long nGrain, const std::function<void( long long, long long )> &fBody );
+};
+
+// fBody( nFrom, nTo ) processes the elements nFrom up to (not including) nTo. The grain is the
+// smallest amount of work worth a task - choose it so that a chunk takes at least some microseconds
+template <class F>
+void flcParallelFor( long long nBegin, long long nEnd, long long nGrain, F fBody ) {
+    flcScheduler::Run( nBegin, nEnd, nGrain, fBody );
+}
+
+// fChunk( nFrom, nTo ) returns the result of the elements nFrom up to nTo, fCombine( a, b ) combines two
+// results. The range is cut in chunks of exactly nGrain elements, and the chunk results are combined
+// in order on the calling thread, so the result doesn't depend on the nr of threads (also not for
+// floating point sums, or for a combine that is not commutative).
+// NOTE: T can't be bool (the chunk results are stored in a vector<T>), use char or int instead
+template <class T, class F, class C>
+T flcParallelReduce( long long nBegin, long long nEnd, long long nGrain, T identity, F fChunk, C fCombine ) {
+    if (nEnd <= nBegin) {
+        return identity;
+    }
+    nGrain = std::max( nGrain, 1LL );
+    long long nChunks = (nEnd - nBegin + nGrain - 1) / nGrain;
+    std::vector<T> vPartial( nChunks, identity );
+    flcScheduler::Run( 0, nChunks, 1, [&]( long long nFromChunk, long long nToChunk ) {
+            for (long long c = nFromChunk; c < nToChunk; c++) {
+                long long nFrom = nBegin + c * nGrain;
+                vPartial[c] = fChunk( nFrom, std::min( nFrom + nGrain, nEnd ));
+            }
+        }
+    );
+    T result = identity;
+    for (auto &e : vPartial) {
+        result = fCombine( result, e );
+    }
+    return result;
+}
+
+// Cuts sText in at most nChunks pieces of about equal size that hold whole lines: each piece but the
+// last ends right after a '\n'. For parsing a big input in parallel - a flcParallelFor() over the pieces.
+std::vector<std::string_view> flcSplitLines( std::string_view sText, int nChunks );
+
+#endif // FLCPARALLEL_H
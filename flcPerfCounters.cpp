@@ -0,0 +1,133 @@
+// AoC 2022 - hardware performance counters
+// ========================================
+
+// date:  2023-01-02
+// by:    Joseph21 (Joseph21-6147)
+
+#include <mutex>
+
+#ifdef __linux__
+#define FLC_USE_PERF_EVENTS
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include "flcPerfCounters.h"
+
+// ==============================/ per thread counter groups /==============================
+
+static std::mutex  glbProblemMutex;
+static std::string glbProblem;      // the first reason found why a counter couldn't be opened
+
+static void SetProblem( const std::string &sProblem ) {
+    std::lock_guard<std::mutex> lock( glbProblemMutex );
+    if (glbProblem.empty()) {
+        glbProblem = sProblem;
+    }
+}
+
+// the counter group of one thread. All counters are read at once via the group leader
+typedef struct sThreadCounters {
+    bool bOpened   = false;              // true once the open is attempted
+    int  nLeaderFd = -1;
+    int  vFd[FLC_NR_COUNTERS];
+    int  vIndex[FLC_NR_COUNTERS];        // position of the counter in the group read, -1 if not open
+    int  nOpen = 0;
+
+    ~sThreadCounters() {
+#ifdef FLC_USE_PERF_EVENTS
+        for (int i = 0; i < FLC_NR_COUNTERS && bOpened; i++) {
+            if (vIndex[i] >= 0) close( vFd[i] );
+        }
+#endif
+    }
+} ThreadCounters;
+static thread_local ThreadCounters glbThreadCounters;
+
+static void OpenCounters( ThreadCounters &tc ) {
+    tc.bOpened = true;
+    for (int i = 0; i < FLC_NR_COUNTERS; i++) {
+        tc.vIndex[i] = -1;
+    }
+#ifdef FLC_USE_PERF_EVENTS
+    static const unsigned long long vConfig[FLC_NR_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for (int i = 0; i < FLC_NR_COUNTERS; i++) {
+        struct perf_event_attr attr;
+        memset( &attr, 0, sizeof( attr ));
+        attr.size           = sizeof( attr );
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.config         = vConfig[i];
+        attr.disabled       = (tc.nLeaderFd < 0) ? 1 : 0;    // the group is started as a whole
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        int fd = (int)syscall( __NR_perf_event_open, &attr, 0, -1, tc.nLeaderFd, 0 );
+        if (fd < 0) {
+            SetProblem( std::string( flcPerfCounters::Name( i )) + ": " + strerror( errno ));
+        } else {
+            if (tc.nLeaderFd < 0) tc.nLeaderFd = fd;
+            tc.vFd[i]    = fd;
+            tc.vIndex[i] = tc.nOpen++;
+        }
+    }
+    if (tc.nLeaderFd >= 0) {
+        ioctl( tc.nLeaderFd, PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP );
+        ioctl( tc.nLeaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+    }
+#else
+    SetProblem( "perf_event_open() is only available on Linux" );
+#endif
+}
+
+// ==============================/ Class flcPerfCounters /==============================
+
+bool flcPerfCounters::Available() {
+    ThreadCounters &tc = glbThreadCounters;
+    if (!tc.bOpened) OpenCounters( tc );
+    return tc.nLeaderFd >= 0;
+}
+
+std::string flcPerfCounters::Problem() {
+    std::lock_guard<std::mutex> lock( glbProblemMutex );
+    return glbProblem;
+}
+
+void flcPerfCounters::Read( flcCounterSample &sample ) {
+    for (int i = 0; i < FLC_NR_COUNTERS; i++) {
+        sample.nValue[i] = -1;
+    }
+    ThreadCounters &tc = glbThreadCounters;
+    if (!tc.bOpened) OpenCounters( tc );
+#ifdef FLC_USE_PERF_EVENTS
+    if (tc.nLeaderFd >= 0) {
+        // layout of a group read: nr of counters, time enabled, time running, the counter values
+        unsigned long long vBuf[3 + FLC_NR_COUNTERS];
+        if (read( tc.nLeaderFd, vBuf, sizeof( vBuf )) > 0) {
+            // if the kernel had to multiplex the counters, scale them up to the full time
+            double dScale = (vBuf[2] > 0 && vBuf[2] < vBuf[1]) ? (double)vBuf[1] / (double)vBuf[2] : 1.0;
+            for (int i = 0; i < FLC_NR_COUNTERS; i++) {
+                if (tc.vIndex[i] >= 0) {
+                    sample.nValue[i] = (long long)(vBuf[3 + tc.vIndex[i]] * dScale);
+                }
+            }
+        }
+    }
+#endif
+}
+
+const char *flcPerfCounters::Name( int nCounter ) {
+    switch (nCounter) {
+        case FLC_CYCLES:        return "cycles";
+        case FLC_INSTRUCTIONS:  return "instructions";
+        case FLC_CACHE_MISSES:  return "cache misses";
+        case FLC_BRANCH_MISSES: return "branch misses";
+    }
+    return "unknown";
+}
@@ -0,0 +1,42 @@
+// AoC 2022 - hardware performance counters
+// ========================================
+
+// date:  2023-01-02
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCPERFCOUNTERS_H
+#define FLCPERFCOUNTERS_H
+
+#include <string>
+
+// the hardware counters that are sampled
+enum eFlcCounter {
+    FLC_CYCLES = 0,
+    FLC_INSTRUCTIONS,
+    FLC_CACHE_MISSES,
+    FLC_BRANCH_MISSES,
+    FLC_NR_COUNTERS
+};
+
+// one sample of all counters - a counter that is not available has value -1
+typedef struct sCounterSample {
+    long long nValue[FLC_NR_COUNTERS];
+} flcCounterSample;
+
+// Reads the hardware counters of the calling thread, with the Linux perf_event_open() interface
+// (user space only). Each thread opens its own counter group, at its first Read().
+// When the counters can't be opened (not Linux, no PMU in a virtual machine, or not allowed by
+// /proc/sys/kernel/perf_event_paranoid), all samples are -1. The caller only loses the numbers,
+// nothing fails.
+class flcPerfCounters {
+public:
+    // returns false if none of the counters can be opened on the calling thread
+    static bool Available();
+    // the reason why (some of) the counters are not available - empty if they all are
+    static std::string Problem();
+
+    static void Read( flcCounterSample &sample );
+    static const char *Name( int nCounter );
+};
+
+#endif // FLCPERFCOUNTERS_H
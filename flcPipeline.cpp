@@ -0,0 +1,121 @@
+// AoC 2022 - pipelined read, parse and solve
+// ==========================================
+
+// date:  2023-01-09
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <algorithm>
+
+#include "flcPipeline.h"
+
+// ==============================/ Class flcBlockReader /==============================
+
+bool flcBlockReader::Open( const std::string &sFileName ) {
+    Close();
+    if (sFileName == "-") {
+        m_pFile  = stdin;
+        m_bStdIn = true;
+    } else {
+        m_pFile = fopen( sFileName.c_str(), "rb" );
+    }
+    if (m_pFile == nullptr) {
+        std::cout << "ERROR: flcBlockReader::Open() --> can't open file: " << sFileName << std::endl;
+        return false;
+    }
+    // the reads go straight into the blocks, so the buffer of the FILE itself is not needed
+    setvbuf( m_pFile, nullptr, _IONBF, 0 );
+
+    // all blocks start at the reader. The queues can hold all of them, so a push never has to wait
+    m_vBlocks.assign( m_nBlocks, Block());
+    m_pFree = std::make_unique<flcSpscQueue<int>>( m_nBlocks );
+    m_pFull = std::make_unique<flcSpscQueue<int>>( m_nBlocks );
+    for (int i = 0; i < m_nBlocks; i++) {
+        m_vBlocks[i].vData.resize( std::max( m_nBlockSize, (size_t)1 ));
+        m_pFree->Push( i );
+    }
+    m_nCurrent   = -1;
+    m_nBytesRead = 0;
+    m_thread = std::thread( &flcBlockReader::ReadLoop, this );
+    return true;
+}
+
+void flcBlockReader::Close() {
+    if (m_thread.joinable()) {
+        // a reader that waits for a free block sees the close, and stops
+        m_pFree->Close();
+        m_thread.join();
+    }
+    if (m_pFile != nullptr && !m_bStdIn) {
+        fclose( m_pFile );
+    }
+    m_pFile  = nullptr;
+    m_bStdIn = false;
+    m_vBlocks.clear();
+    m_pFree.reset();
+    m_pFull.reset();
+    m_nCurrent = -1;
+}
+
+// Runs on the reader thread. The unfinished last line of a block is carried over to the front of
+// the next block. A block without any line terminator in it is doubled and filled further.
+void flcBlockReader::ReadLoop() {
+    std::vector<char> vCarry;
+    bool bEof = false;
+    int nBlock;
+    while (!bEof && m_pFree->Pop( nBlock )) {
+        Block &blk = m_vBlocks[nBlock];
+        if (blk.vData.size() < 2 * vCarry.size()) {
+            blk.vData.resize( 2 * vCarry.size());
+        }
+        std::copy( vCarry.begin(), vCarry.end(), blk.vData.begin());
+        blk.nLength = vCarry.size();
+        vCarry.clear();
+
+        size_t nLastEol = std::string::npos;
+        while (nLastEol == std::string::npos) {
+            if (blk.nLength == blk.vData.size()) {
+                blk.vData.resize( 2 * blk.vData.size());
+            }
+            size_t nRead = fread( blk.vData.data() + blk.nLength, 1, blk.vData.size() - blk.nLength, m_pFile );
+            if (nRead == 0) {
+                bEof = true;
+                break;
+            }
+            m_nBytesRead += nRead;
+            for (size_t i = blk.nLength + nRead; i > blk.nLength && nLastEol == std::string::npos; i--) {
+                if (blk.vData[i - 1] == '\n') {
+                    nLastEol = i - 1;
+                }
+            }
+            blk.nLength += nRead;
+        }
+        // at the end of the input a last line without terminator stays in the block
+        if (!bEof) {
+            vCarry.assign( blk.vData.data() + nLastEol + 1, blk.vData.data() + blk.nLength );
+            blk.nLength = nLastEol + 1;
+        }
+        if (blk.nLength > 0) {
+            m_pFull->Push( nBlock );
+        }
+    }
+    m_pFull->Close();
+}
+
+bool flcBlockReader::NextBlock( std::string_view &sBlock ) {
+    if (!m_thread.joinable()) {
+        return false;
+    }
+    // the previous block goes back to the reader
+    if (m_nCurrent >= 0) {
+        m_pFree->Push( m_nCurrent );
+        m_nCurrent = -1;
+    }
+    int nBlock;
+    if (!m_pFull->Pop( nBlock )) {
+        return false;
+    }
+    m_nCurrent = nBlock;
+    sBlock = std::string_view( m_vBlocks[nBlock].vData.data(), m_vBlocks[nBlock].nLength );
+    return true;
+}
@@ -0,0 +1,206 @@
+// AoC 2022 - pipelined read, parse and solve
+// ==========================================
+
+// date:  2023-01-09
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCPIPELINE_H
+#define FLCPIPELINE_H
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+
+// A pipeline has three stages, each on its own thread: a reader thread fills blocks of whole lines
+// from the input (flcBlockReader), a parser thread turns the lines into records, and the calling
+// thread folds the records into the answers (flcRunPipeline()). The stages pass their work on
+// through bounded lock free queues, so reading, parsing and solving overlap, while the memory use
+// stays constant. It's meant for the days whose solution is a fold over the records of a big input.
+// NOTE: the allocation tracker and the profiler count per thread, so the work of the reader and
+//       the parser thread doesn't show up in the zone of the calling thread
+
+// ==============================/ Class flcSpscQueue /==============================
+
+// Bounded lock free queue for exactly one producer thread and one consumer thread: a ring buffer
+// with a head index that only the consumer writes, and a tail index that only the producer writes.
+// Each side keeps a copy of the other side's index, and only reads the shared one (a cache miss)
+// when the copy says the queue is full or empty.
+template <class T>
+class flcSpscQueue {
+public:
+    // the capacity is rounded up to a power of 2
+    flcSpscQueue( size_t nCapacity = 1024 ) {
+        size_t nSize = 2;
+        while (nSize < nCapacity) {
+            nSize *= 2;
+        }
+        m_vSlots.resize( nSize );
+        m_nMask = nSize - 1;
+    }
+    flcSpscQueue( const flcSpscQueue & ) = delete;
+    flcSpscQueue &operator = ( const flcSpscQueue & ) = delete;
+
+    size_t Capacity() { return m_vSlots.size(); }
+
+    // producer side - returns false if the queue is full
+    bool TryPush( const T &t ) {
+        size_t nTail = m_nTail.load( std::memory_order_relaxed );
+        if (nTail - m_nHeadCopy == m_vSlots.size()) {
+            m_nHeadCopy = m_nHead.load( std::memory_order_acquire );
+            if (nTail - m_nHeadCopy == m_vSlots.size()) {
+                return false;
+            }
+        }
+        m_vSlots[nTail & m_nMask] = t;
+        m_nTail.store( nTail + 1, std::memory_order_release );
+        return true;
+    }
+    // producer side - waits while the queue is full
+    void Push( const T &t ) {
+        for (int nTries = 0; !TryPush( t ); nTries++) {
+            Backoff( nTries );
+        }
+    }
+    // producer side - there will be no more pushes
+    void Close() { m_bClosed.store( true, std::memory_order_release ); }
+
+    // consumer side - returns false if the queue is empty
+    bool TryPop( T &t ) {
+        size_t nHead = m_nHead.load( std::memory_order_relaxed );
+        if (nHead == m_nTailCopy) {
+            m_nTailCopy = m_nTail.load( std::memory_order_acquire );
+            if (nHead == m_nTailCopy) {
+                return false;
+            }
+        }
+        t = m_vSlots[nHead & m_nMask];
+        m_nHead.store( nHead + 1, std::memory_order_release );
+        return true;
+    }
+    // consumer side - waits while the queue is empty. Returns false if it's empty and closed
+    bool Pop( T &t ) {
+        for (int nTries = 0; !TryPop( t ); nTries++) {
+            if (m_bClosed.load( std::memory_order_acquire )) {
+                // all pushes were done before the close, so one more try sees all of them
+                return TryPop( t );
+            }
+            Backoff( nTries );
+        }
+        return true;
+    }
+
+private:
+    // spins for a short while, then gives up the time slice on each try
+    static void Backoff( int nTries ) {
+        if (nTries > 64) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::vector<T> m_vSlots;
+    size_t         m_nMask;
+    std::atomic<bool> m_bClosed{ false };
+    // the consumer's and the producer's data are on separate cache lines
+    alignas( 64 ) std::atomic<size_t> m_nHead{ 0 };
+    size_t                            m_nTailCopy = 0;
+    alignas( 64 ) std::atomic<size_t> m_nTail{ 0 };
+    size_t                            m_nHeadCopy = 0;
+};
+
+// ==============================/ Class flcBlockReader /==============================
+
+// The reader stage: a thread that reads the input in blocks, and hands them over to one consumer.
+// Each block holds only whole lines (the unfinished last line is moved to the next block), and a
+// block is only reused by the reader when the consumer asks for the next one. The file name "-"
+// means stdin. Like flcStreamReader, the block size only grows for a line that is longer than a block.
+class flcBlockReader {
+public:
+    flcBlockReader( size_t nBlockSize = 1 << 18, int nBlocks = 4 ) : m_nBlockSize( nBlockSize ), m_nBlocks( nBlocks ) {}
+    ~flcBlockReader() { Close(); }
+
+    flcBlockReader( const flcBlockReader & ) = delete;
+    flcBlockReader &operator = ( const flcBlockReader & ) = delete;
+
+    // opens the input and starts the reader thread. Returns false (and reports an error) if the
+    // file can't be opened
+    bool Open( const std::string &sFileName );
+    // stops the reader thread (also if the input is not read completely) and closes the input
+    void Close();
+
+    // Returns the next block of whole lines (line terminators included), false at the end of the input.
+    // NOTE: a block is only valid until the next call to NextBlock()
+    bool NextBlock( std::string_view &sBlock );
+
+    // nr of bytes read from the input so far
+    long long BytesRead() { return m_nBytesRead.load(); }
+
+private:
+    void ReadLoop();
+
+    typedef struct sBlock {
+        std::vector<char> vData;
+        size_t            nLength = 0;
+    } Block;
+
+    size_t                             m_nBlockSize;
+    int                                m_nBlocks;
+    FILE                              *m_pFile = nullptr;
+    bool                               m_bStdIn = false;
+    std::vector<Block>                 m_vBlocks;
+    std::unique_ptr<flcSpscQueue<int>> m_pFree, m_pFull;    // block indices: to the reader and back
+    int                                m_nCurrent = -1;     // the block the consumer has
+    std::thread                        m_thread;
+    std::atomic<long long>             m_nBytesRead{ 0 };
+};
+
+// ==============================/ running a pipeline /==============================
+
+// Calls fLine( sLine ) for each line in sBlock, without its terminator ("\n" or "\r\n").
+template <class F>
+void flcForEachLine( std::string_view sBlock, F fLine ) {
+    size_t nBegin = 0;
+    while (nBegin < sBlock.length()) {
+        size_t nEol  = sBlock.find( '\n', nBegin );
+        size_t nNext = (nEol == std::string_view::npos) ? sBlock.length() : nEol + 1;
+        size_t nEnd  = (nEol == std::string_view::npos) ? sBlock.length() : nEol;
+        if (nEnd > nBegin && sBlock[nEnd - 1] == '\r') {
+            nEnd -= 1;
+        }
+        fLine( sBlock.substr( nBegin, nEnd - nBegin ));
+        nBegin = nNext;
+    }
+}
+
+// Runs the parser and the solver stage on the blocks of reader. fParse( sLine, rec ) is called on the
+// parser thread for each line, and returns true if the line gave a record R. fFold( rec ) is called
+// on the calling thread for each record, in input order. Returns when all records are folded.
+// R is passed by value through the queue, so keep it small (a few numbers, no strings).
+template <class R, class P, class F>
+void flcRunPipeline( flcBlockReader &reader, P fParse, F fFold, size_t nQueueSize = 1 << 14 ) {
+    flcSpscQueue<R> queue( nQueueSize );
+    std::thread parser( [&]() {
+            std::string_view sBlock;
+            R rec;
+            while (reader.NextBlock( sBlock )) {
+                flcForEachLine( sBlock, [&]( std::string_view sLine ) {
+                        if (fParse( sLine, rec )) {
+                            queue.Push( rec );
+                        }
+                    }
+                );
+            }
+            queue.Close();
+        }
+    );
+    R rec;
+    while (queue.Pop( rec )) {
+        fFold( rec );
+    }
+    parser.join();
+}
+
+#endif // FLCPIPELINE_H
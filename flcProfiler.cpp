@@ -0,0 +1,212 @@
+// AoC 2022 - scoped zone profiler
+// ===============================
+
+// date:  2022-12-28
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iomanip>
+#include <sstream>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+#include "flcProfiler.h"
+
+// ==============================/ per thread zone trees /==============================
+
+bool flcProfiler::m_bEnabled  = false;
+bool flcProfiler::m_bCounters = false;
+
+// all zone trees (one per thread) are kept in a global list, so that they survive their
+// threads and can be merged for the report
+static std::mutex                    glbTreesMutex;
+static std::vector<flcProfileNode *> glbTrees;
+static std::atomic<int>              glbGeneration( 0 );   // increased by Reset()
+
+// the zone tree of the current thread, and the zone that is currently open in it
+typedef struct sThreadTree {
+    flcProfileNode *pRoot = nullptr;
+    flcProfileNode *pCur  = nullptr;
+    int nGeneration = -1;
+} ThreadTree;
+static thread_local ThreadTree glbThreadTree;
+
+static void DisposeTree( flcProfileNode *pNode ) {
+    for (auto &e : pNode->vKids) {
+        DisposeTree( e );
+    }
+    delete pNode;
+}
+
+void flcProfiler::Enable( bool bEnable ) { m_bEnabled = bEnable; }
+
+bool flcProfiler::EnableCounters( bool bEnable ) {
+    m_bCounters = bEnable && flcPerfCounters::Available();
+    return m_bCounters == bEnable;
+}
+
+void flcProfiler::Reset() {
+    std::lock_guard<std::mutex> lock( glbTreesMutex );
+    for (auto &e : glbTrees) {
+        DisposeTree( e );
+    }
+    glbTrees.clear();
+    // the threads notice the new generation and start a fresh tree at their next zone
+    glbGeneration += 1;
+}
+
+flcProfileNode *flcProfiler::EnterZone( const char *sName ) {
+    ThreadTree &tt = glbThreadTree;
+    if (tt.nGeneration != glbGeneration) {
+        tt.pRoot = new flcProfileNode;
+        tt.pRoot->sName = "<root>";
+        tt.pCur = tt.pRoot;
+        tt.nGeneration = glbGeneration;
+
+        std::lock_guard<std::mutex> lock( glbTreesMutex );
+        glbTrees.push_back( tt.pRoot );
+    }
+    // find the zone among the kids of the current zone, or create it
+    flcProfileNode *pNode = nullptr;
+    for (int i = 0; i < (int)tt.pCur->vKids.size() && pNode == nullptr; i++) {
+        if (tt.pCur->vKids[i]->sName == sName) {
+            pNode = tt.pCur->vKids[i];
+        }
+    }
+    if (pNode == nullptr) {
+        pNode = new flcProfileNode;
+        pNode->sName   = sName;
+        pNode->pParent = tt.pCur;
+        tt.pCur->vKids.push_back( pNode );
+    }
+    tt.pCur = pNode;
+    return pNode;
+}
+
+// a counter that was not available once, stays not available (-1) for the zone
+static void AddCounters( long long *pDst, const long long *pSrc ) {
+    for (int i = 0; i < FLC_NR_COUNTERS; i++) {
+        pDst[i] = (pDst[i] < 0 || pSrc[i] < 0) ? -1 : pDst[i] + pSrc[i];
+    }
+}
+
+void flcProfiler::LeaveZone( flcProfileNode *pNode, long long nDurationNs, long long nRecords,
+                             const flcAllocStats &allocs, const flcCounterSample *pDelta ) {
+    pNode->nCalls       += 1;
+    pNode->nInclusiveNs += nDurationNs;
+    pNode->nRecords     += nRecords;
+    pNode->nAllocs      += allocs.nAllocs;
+    pNode->nAllocBytes  += allocs.nBytes;
+    pNode->nPeakLive     = std::max( pNode->nPeakLive, allocs.nPeakLive );
+    if (pDelta != nullptr) {
+        AddCounters( pNode->vCounters, pDelta->nValue );
+    }
+    if (pNode->pParent != nullptr) {
+        pNode->pParent->nChildNs += nDurationNs;
+    }
+    glbThreadTree.pCur = pNode->pParent;
+}
+
+// ==============================/ reporting /==============================
+
+// adds the statistics of tree pSrc (recursively) into the tree pDst, matching zones by name
+static void MergeTree( flcProfileNode *pDst, flcProfileNode *pSrc ) {
+    pDst->nCalls       += pSrc->nCalls;
+    pDst->nInclusiveNs += pSrc->nInclusiveNs;
+    pDst->nChildNs     += pSrc->nChildNs;
+    pDst->nRecords     += pSrc->nRecords;
+    pDst->nAllocs      += pSrc->nAllocs;
+    pDst->nAllocBytes  += pSrc->nAllocBytes;
+    pDst->nPeakLive     = std::max( pDst->nPeakLive, pSrc->nPeakLive );
+    AddCounters( pDst->vCounters, pSrc->vCounters );
+    for (auto &srcKid : pSrc->vKids) {
+        flcProfileNode *pDstKid = nullptr;
+        for (int i = 0; i < (int)pDst->vKids.size() && pDstKid == nullptr; i++) {
+            if (pDst->vKids[i]->sName == srcKid->sName) {
+                pDstKid = pDst->vKids[i];
+            }
+        }
+        if (pDstKid == nullptr) {
+            pDstKid = new flcProfileNode;
+            pDstKid->sName   = srcKid->sName;
+            pDstKid->pParent = pDst;
+            pDst->vKids.push_back( pDstKid );
+        }
+        MergeTree( pDstKid, srcKid );
+    }
+}
+
+// prints the counter columns of one zone - a "-" for the numbers that are not available
+static void ReportCounters( std::ostream &os, flcProfileNode *pNode ) {
+    long long *pCnt = pNode->vCounters;
+    auto ratio = [&]( long long a, long long b, int nPrec ) {
+        std::ostringstream ss;
+        if (a < 0 || b <= 0) {
+            ss << "-";
+        } else {
+            ss << std::fixed << std::setprecision( nPrec ) << (double)a / (double)b;
+        }
+        return ss.str();
+    };
+    auto count = [&]( long long a ) { return (a < 0) ? std::string( "-" ) : std::to_string( a ); };
+
+    os << std::setw(  8 ) << ratio( pCnt[FLC_INSTRUCTIONS], pCnt[FLC_CYCLES], 2 )
+       << std::setw( 14 ) << count( pCnt[FLC_CACHE_MISSES] )
+       << std::setw( 14 ) << count( pCnt[FLC_BRANCH_MISSES] )
+       << std::setw( 10 ) << ratio( pCnt[FLC_CACHE_MISSES],  pNode->nRecords, 1 )
+       << std::setw( 10 ) << ratio( pCnt[FLC_BRANCH_MISSES], pNode->nRecords, 1 );
+}
+
+static void ReportNode( std::ostream &os, flcProfileNode *pNode, int nIndent ) {
+    // the most expensive zones first
+    std::sort( pNode->vKids.begin(), pNode->vKids.end(), []( flcProfileNode *a, flcProfileNode *b ) {
+            return a->nInclusiveNs > b->nInclusiveNs;
+        }
+    );
+    for (auto &e : pNode->vKids) {
+        std::string sLabel = std::string( nIndent, ' ' ) + e->sName;
+        os << "  " << std::left << std::setw( 40 ) << sLabel << std::right
+           << std::setw( 12 ) << e->nCalls
+           << std::setw( 16 ) << e->nInclusiveNs / 1.0e6
+           << std::setw( 16 ) << (e->nInclusiveNs - e->nChildNs) / 1.0e6
+           << std::setw( 12 ) << e->nAllocs
+           << std::setw( 14 ) << e->nAllocBytes
+           << std::setw( 14 ) << e->nPeakLive;
+        if (flcProfiler::CountersEnabled()) {
+            ReportCounters( os, e );
+        }
+        os << std::endl;
+        ReportNode( os, e, nIndent + 2 );
+    }
+}
+
+void flcProfiler::Report( std::ostream &os ) {
+    flcProfileNode merged;
+    {
+        std::lock_guard<std::mutex> lock( glbTreesMutex );
+        for (auto &e : glbTrees) {
+            MergeTree( &merged, e );
+        }
+    }
+    os << "Profile report (msec, exclusive = inclusive minus the time of the child zones, allocations inclusive)" << std::endl;
+    os << "  " << std::left << std::setw( 40 ) << "zone" << std::right
+       << std::setw( 12 ) << "calls" << std::setw( 16 ) << "inclusive" << std::setw( 16 ) << "exclusive"
+       << std::setw( 12 ) << "allocs" << std::setw( 14 ) << "alloc bytes" << std::setw( 14 ) << "peak live";
+    if (CountersEnabled()) {
+        // the counters are inclusive, the per record columns are misses per input record
+        os << std::setw( 8 ) << "IPC" << std::setw( 14 ) << "cache miss" << std::setw( 14 ) << "branch miss"
+           << std::setw( 10 ) << "cm/rec" << std::setw( 10 ) << "bm/rec";
+    }
+    os << std::endl;
+
+    std::ios_base::fmtflags oldFlags = os.flags();
+    std::streamsize oldPrecision = os.precision( 6 );
+    os << std::fixed;
+    ReportNode( os, &merged, 0 );
+    os.flags( oldFlags );
+    os.precision( oldPrecision );
+
+    for (auto &e : merged.vKids) {
+        DisposeTree( e );
+    }
+}
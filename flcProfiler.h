@@ -0,0 +1,122 @@
+// AoC 2022 - scoped zone profiler
+// ===============================
+
+// date:  2022-12-28
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCPROFILER_H
+#define FLCPROFILER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "flcTimer.h"
+#include "flcPerfCounters.h"
+#include "flcAllocTracker.h"
+
+// Usage: put a named zone at the start of a block, e.g.
+//
+//     void Solve_AStar( ... ) {
+//         FLC_PROFILE_ZONE( "Solve_AStar" );
+//         ...
+//     }
+//
+// Zones nest: a zone that is opened while another zone is open becomes a child of it. Per zone
+// (per position in the zone tree) the profiler records the nr of calls, the inclusive time (time
+// spent in the zone and its children) and the exclusive time (inclusive minus the time of the
+// child zones), in nanoseconds. Each thread builds its own zone tree, so zones are cheap and need
+// no locking. The report merges the trees of all threads.
+// The heap allocations in each zone are counted as well (see flcAllocTracker.h).
+// Optionally (EnableCounters()) each zone also samples the hardware counters of its thread when it is
+// entered and left, and the report adds IPC and cache / branch misses. That costs two system calls per
+// zone, so it's meant for coarse zones. A zone that knows how many input records it processes can
+// pass that with SetRecords(), to get the misses per record in the report.
+// The profiler is disabled by default. A disabled zone costs one test on a bool.
+
+// one node in the zone tree
+typedef struct sProfileNode {
+    std::string sName;
+    long long   nCalls       = 0;
+    long long   nInclusiveNs = 0;
+    long long   nChildNs     = 0;      // accumulated inclusive time of the child zones
+    long long   nRecords     = 0;      // accumulated nr of records, see flcProfileZone::SetRecords()
+    long long   nAllocs      = 0;      // accumulated nr of heap allocations
+    long long   nAllocBytes  = 0;      // accumulated nr of bytes allocated
+    long long   nPeakLive    = 0;      // highest peak of live heap bytes over the calls
+    long long   vCounters[FLC_NR_COUNTERS] = { 0, 0, 0, 0 };    // inclusive, -1 if not available
+    struct sProfileNode *pParent = nullptr;
+    std::vector<struct sProfileNode *> vKids;
+} flcProfileNode;
+
+class flcProfiler {
+public:
+    static void Enable( bool bEnable );
+    static bool IsEnabled() { return m_bEnabled; }
+    // returns false (and leaves the counters disabled) if the hardware counters are not available
+    static bool EnableCounters( bool bEnable );
+    static bool CountersEnabled() { return m_bCounters; }
+
+    // clears the zone trees of all threads - call only when no zones are open
+    static void Reset();
+
+    // prints the merged zone tree of all threads
+    static void Report( std::ostream &os = std::cout );
+
+    // used by flcProfileZone - enter returns the node for the zone, leave closes it again
+    static flcProfileNode *EnterZone( const char *sName );
+    // pDelta (may be nullptr) holds the counter values over the zone
+    static void LeaveZone( flcProfileNode *pNode, long long nDurationNs, long long nRecords,
+                           const flcAllocStats &allocs, const flcCounterSample *pDelta );
+
+private:
+    static bool m_bEnabled;
+    static bool m_bCounters;
+};
+
+// RAII guard that times one zone
+class flcProfileZone {
+public:
+    flcProfileZone( const char *sName ) : m_tmr( false ) {
+        m_pNode = flcProfiler::IsEnabled() ? flcProfiler::EnterZone( sName ) : nullptr;
+        m_bCounters = (m_pNode != nullptr && flcProfiler::CountersEnabled());
+        if (m_bCounters) flcPerfCounters::Read( m_start );
+        if (m_pNode != nullptr) {
+            flcAllocTracker::Begin( m_allocMark );
+            m_tmr.StartTiming();
+        }
+    }
+    ~flcProfileZone() {
+        if (m_pNode != nullptr) {
+            long long nDurationNs = m_tmr.ElapsedNs();
+            flcAllocStats allocs = flcAllocTracker::End( m_allocMark );
+            if (m_bCounters) {
+                flcCounterSample stop;
+                flcPerfCounters::Read( stop );
+                for (int i = 0; i < FLC_NR_COUNTERS; i++) {
+                    stop.nValue[i] = (stop.nValue[i] < 0 || m_start.nValue[i] < 0) ? -1 : stop.nValue[i] - m_start.nValue[i];
+                }
+                flcProfiler::LeaveZone( m_pNode, nDurationNs, m_nRecords, allocs, &stop );
+            } else {
+                flcProfiler::LeaveZone( m_pNode, nDurationNs, m_nRecords, allocs, nullptr );
+            }
+        }
+    }
+
+    // the nr of input records that this zone processes
+    void SetRecords( long long nRecords ) { m_nRecords = nRecords; }
+
+private:
+    flcProfileNode  *m_pNode;
+    flcTimer         m_tmr;
+    bool             m_bCounters;
+    flcCounterSample m_start;
+    flcAllocMark     m_allocMark;
+    long long        m_nRecords = 0;
+};
+
+#define FLC_CONCAT_INNER( a, b ) a##b
+#define FLC_CONCAT( a, b ) FLC_CONCAT_INNER( a, b )
+#define FLC_PROFILE_ZONE( name ) flcProfileZone FLC_CONCAT( flcZone_, __LINE__ )( name )
+
+#endif // FLCPROFILER_H
@@ -0,0 +1,132 @@
+// AoC 2022 - cache of the answers per day and input
+// =================================================
+
+// date:  2023-01-08
+// by:    Joseph21 (Joseph21-6147)
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <filesystem>
+
+#include "flcResultCache.h"
+
+// ==============================/ file layout /==============================
+
+// A results file looks like this (the answers are escaped, so that multi line answers like the
+// picture of day 10 fit on one line):
+//     FLCR 1
+//     build exe 3f6a09c2d41b7e85
+//     input 0.734
+//     part 1 1.207 68802
+//     part 2 0.015 205370
+
+static std::string ResultsFileName( const std::string &sDir, int nDay, const std::string &sPhase, unsigned long long nInputHash ) {
+    std::stringstream ss;
+    ss << "day" << std::setw( 2 ) << std::setfill( '0' ) << nDay << "." << sPhase << "." << std::hex << std::setw( 16 ) << nInputHash << ".txt";
+    return (std::filesystem::path( sDir ) / ss.str()).string();
+}
+
+static std::string Escape( const std::string &s ) {
+    std::string sResult;
+    for (char c : s) {
+        switch (c) {
+            case '\\': sResult += "\\\\"; break;
+            case '\n': sResult += "\\n";  break;
+            case '\r': sResult += "\\r";  break;
+            default  : sResult += c;      break;
+        }
+    }
+    return sResult;
+}
+
+static std::string Unescape( const std::string &s ) {
+    std::string sResult;
+    for (size_t i = 0; i < s.length(); i++) {
+        if (s[i] == '\\' && i + 1 < s.length()) {
+            i += 1;
+            sResult += (s[i] == 'n') ? '\n' : (s[i] == 'r') ? '\r' : s[i];
+        } else {
+            sResult += s[i];
+        }
+    }
+    return sResult;
+}
+
+// ==============================/ load and save /==============================
+
+bool flcLoadResults( const std::string &sDir, int nDay, const std::string &sPhase, unsigned long long nInputHash, flcResultEntry &entry ) {
+    std::ifstream inFileStream( ResultsFileName( sDir, nDay, sPhase, nInputHash ), std::ios::binary );
+    if (!inFileStream.is_open()) {
+        return false;
+    }
+    flcResultEntry aux;
+    std::string sLine;
+    int nFormat = 0;
+    bool bBuild = false, bInput = false;
+    while (std::getline( inFileStream, sLine )) {
+        std::istringstream ss( sLine );
+        std::string sTag;
+        ss >> sTag;
+        if (sTag == "FLCR") {
+            ss >> nFormat;
+        } else if (sTag == "build") {
+            bBuild = (sLine.length() > 6);
+            aux.sBuildId = bBuild ? sLine.substr( 6 ) : "";
+        } else if (sTag == "input") {
+            bInput = (bool)(ss >> aux.dTimeInputMs);
+        } else if (sTag == "part") {
+            int nPart;
+            double dTime;
+            if (!(ss >> nPart >> dTime) || nPart < 1 || nPart > 2) {
+                return false;
+            }
+            // the answer is the rest of the line after one space (it may be empty, or contain spaces)
+            std::string sRest;
+            std::getline( ss, sRest );
+            flcResultRecord &rec = aux.parts[nPart - 1];
+            rec.bValid  = true;
+            rec.dTimeMs = dTime;
+            rec.sAnswer = Unescape( sRest.empty() ? sRest : sRest.substr( 1 ));
+        }
+    }
+    if (nFormat != FLC_RESULTS_FORMAT || !bBuild || !bInput) {
+        return false;
+    }
+    entry = aux;
+    return true;
+}
+
+bool flcSaveResults( const std::string &sDir, int nDay, const std::string &sPhase, unsigned long long nInputHash, const flcResultEntry &entry ) {
+    std::error_code ec;
+    std::filesystem::create_directories( sDir, ec );
+
+    std::string sFileName = ResultsFileName( sDir, nDay, sPhase, nInputHash );
+    std::string sTmpName  = sFileName + ".tmp";
+    bool bOK;
+    {
+        std::ofstream outFileStream( sTmpName, std::ios::binary );
+        if (!outFileStream.is_open()) {
+            return false;
+        }
+        outFileStream << std::fixed << std::setprecision( 3 );
+        outFileStream << "FLCR "  << FLC_RESULTS_FORMAT << "\n";
+        outFileStream << "build " << entry.sBuildId     << "\n";
+        outFileStream << "input " << entry.dTimeInputMs << "\n";
+        for (int i = 0; i < 2; i++) {
+            if (entry.parts[i].bValid) {
+                outFileStream << "part " << i + 1 << " " << entry.parts[i].dTimeMs << " " << Escape( entry.parts[i].sAnswer ) << "\n";
+            }
+        }
+        outFileStream.close();
+        bOK = !outFileStream.fail();
+    }
+    if (bOK) {
+        bOK = (std::rename( sTmpName.c_str(), sFileName.c_str()) == 0);
+    }
+    if (!bOK) {
+        std::remove( sTmpName.c_str());
+    }
+    return bOK;
+}
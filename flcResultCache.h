@@ -0,0 +1,39 @@
+// AoC 2022 - cache of the answers per day and input
+// =================================================
+
+// date:  2023-01-08
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCRESULTCACHE_H
+#define FLCRESULTCACHE_H
+
+#include <string>
+
+// Bump this when the layout of the results files changes
+#define FLC_RESULTS_FORMAT 1
+
+// the cached answer and timing of one part
+typedef struct sResultRecord {
+    bool        bValid = false;    // false if this part is not in the cache
+    std::string sAnswer;
+    double      dTimeMs = 0.0;     // the time it took to solve the part, in the run that cached it
+} flcResultRecord;
+
+// What the results cache holds for one day, phase and input file. The build id identifies the runner
+// binary that made the answers - answers of another build can only be used to verify against.
+typedef struct sResultEntry {
+    std::string     sBuildId;
+    double          dTimeInputMs = 0.0;
+    flcResultRecord parts[2];
+} flcResultEntry;
+
+// Each entry is a small text file in directory sDir, named after the day, the phase (some days solve
+// another question for the test input, like day 15) and the hash of the contents of the input file
+// (see flcHashFile() in flcInputCache.h), like day07.puzzle.0123456789abcdef.txt.
+// Load returns false if there's no (valid) entry for this day, phase and input.
+bool flcLoadResults( const std::string &sDir, int nDay, const std::string &sPhase, unsigned long long nInputHash, flcResultEntry &entry );
+// Writes (replaces) the entry. It's written under a temporary name first, so a reader never sees a
+// half written file. Returns false if it can't be written.
+bool flcSaveResults( const std::string &sDir, int nDay, const std::string &sPhase, unsigned long long nInputHash, const flcResultEntry &entry );
+
+#endif // FLCRESULTCACHE_H
@@ -0,0 +1,106 @@
+// AoC 2022 - SIMD text scanning
+// =============================
+
+// date:  2023-01-11
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCSIMDTEXT_H
+#define FLCSIMDTEXT_H
+
+#include <cstring>
+#include <cstddef>
+
+// Building blocks for parsers that scan the raw bytes of an input file (see flcInputFile::Contents())
+// instead of going line by line: find all line terminators in a block of bytes with one SIMD compare,
+// and convert a run of up to 8 digits with a few multiplications instead of digit by digit.
+//
+// The block compare uses AVX2 if the compiler targets it (like with -mavx2 or -march=native), otherwise
+// SSE2 (always there on x86-64), and a plain loop on other platforms or if FLC_TEXT_NO_SIMD is defined.
+// NOTE: both functions read a fixed nr of bytes, also past the end of what they look at - near the end
+//       of a buffer the caller must use the plain functions (like flcToNumber()) instead
+
+#if !defined( FLC_TEXT_NO_SIMD )
+    #if defined( __AVX2__ )
+        #define FLC_TEXT_AVX2
+        #include <immintrin.h>
+    #elif defined( __SSE2__ ) || defined( _M_X64 )
+        #define FLC_TEXT_SSE2
+        #include <emmintrin.h>
+    #endif
+#endif
+
+#if defined( _MSC_VER )
+    #include <intrin.h>
+#endif
+
+// nr of bytes that flcByteMask() looks at
+#if defined( FLC_TEXT_AVX2 )
+constexpr size_t FLC_TEXT_BLOCK = 32;
+#else
+constexpr size_t FLC_TEXT_BLOCK = 16;
+#endif
+
+// Returns a mask with bit i set if p[i] == c, for the FLC_TEXT_BLOCK bytes starting at p
+inline unsigned int flcByteMask( const char *p, char c ) {
+#if defined( FLC_TEXT_AVX2 )
+    __m256i vBytes = _mm256_loadu_si256( (const __m256i *)p );
+    return (unsigned int)_mm256_movemask_epi8( _mm256_cmpeq_epi8( vBytes, _mm256_set1_epi8( c )));
+#elif defined( FLC_TEXT_SSE2 )
+    __m128i vBytes = _mm_loadu_si128( (const __m128i *)p );
+    return (unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( vBytes, _mm_set1_epi8( c )));
+#else
+    unsigned int nMask = 0;
+    for (size_t i = 0; i < FLC_TEXT_BLOCK; i++) {
+        nMask |= (unsigned int)(p[i] == c) << i;
+    }
+    return nMask;
+#endif
+}
+
+// index of the lowest set bit of nMask - nMask must not be 0
+inline int flcLowestBit( unsigned int nMask ) {
+#if defined( _MSC_VER )
+    unsigned long nIndex;
+    _BitScanForward( &nIndex, nMask );
+    return (int)nIndex;
+#else
+    return __builtin_ctz( nMask );
+#endif
+}
+
+// Converts the nDigits (1 to 8) characters at p to a number, in SWAR fashion (SIMD within a register):
+// the 8 bytes at p are loaded as one 64 bit word, the digits are shifted to the top and the pairs,
+// quads and octets of digits are combined with three multiplications. Returns false if any of the
+// nDigits characters is not a digit (then nValue is not set).
+// NOTE: reads 8 bytes at p. The digits are taken from the low bytes, so this needs a little endian platform
+inline bool flcParse8Digits( const char *p, int nDigits, unsigned int &nValue ) {
+#if defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    nValue = 0;
+    for (int i = 0; i < nDigits; i++) {
+        if (p[i] < '0' || p[i] > '9') return false;
+        nValue = nValue * 10 + (p[i] - '0');
+    }
+    return nDigits > 0;
+#else
+    if (nDigits < 1 || nDigits > 8) {
+        return false;
+    }
+    unsigned long long nWord;
+    memcpy( &nWord, p, 8 );
+    // the digits go to the top bytes, the bytes below them become '0' (leading zeros)
+    int nShift = 8 * (8 - nDigits);
+    nWord = (nShift == 0) ? nWord : ((nWord << nShift) | (0x3030303030303030ULL >> (64 - nShift)));
+    // all bytes must be in '0' .. '9': the high nibble is 3, and adding 6 doesn't carry into it
+    if (((nWord & 0xF0F0F0F0F0F0F0F0ULL) | (((nWord + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) != 0x3333333333333333ULL) {
+        return false;
+    }
+    nWord -= 0x3030303030303030ULL;
+    nWord = (nWord * 10) + (nWord >> 8);                                     // pairs of digits
+    nWord = ((nWord & 0x00FF00FF00FF00FFULL) * 6553601ULL) >> 16;            // quads (100 * hi + lo)
+    nWord = ((nWord & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;     // octet (10000 * hi + lo)
+    nValue = (unsigned int)nWord;
+    return true;
+#endif
+}
+
+#endif // FLCSIMDTEXT_H
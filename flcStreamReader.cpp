@@ -0,0 +1,97 @@
+// AoC 2022 - streaming input reader
+// =================================
+
+// date:  2022-12-31
+// by:    Joseph21 (Joseph21-6147)
+
+#include <iostream>
+#include <cstring>
+
+#include "flcStreamReader.h"
+
+// ==============================/ Class flcStreamReader /==============================
+
+bool flcStreamReader::Open( const std::string &sFileName ) {
+    Close();
+    if (sFileName == "-") {
+        m_pFile  = stdin;
+        m_bStdIn = true;
+    } else {
+        m_pFile = fopen( sFileName.c_str(), "rb" );
+    }
+    if (m_pFile == nullptr) {
+        std::cout << "ERROR: flcStreamReader::Open() --> can't open file: " << sFileName << std::endl;
+        return false;
+    }
+    // the reads go straight into m_vBuffer, so the buffer of the FILE itself is not needed
+    setvbuf( m_pFile, nullptr, _IONBF, 0 );
+    return true;
+}
+
+void flcStreamReader::Close() {
+    if (m_pFile != nullptr && !m_bStdIn) {
+        fclose( m_pFile );
+    }
+    m_pFile      = nullptr;
+    m_bStdIn     = false;
+    m_bEof       = false;
+    m_nBegin     = 0;
+    m_nEnd       = 0;
+    m_nBytesRead = 0;
+}
+
+// Moves the part that is not consumed yet to the front of the buffer, and reads as much as fits
+// after it. The buffer is doubled if it's full already. Returns false if nothing could be read
+bool flcStreamReader::Fill() {
+    if (m_pFile == nullptr || m_bEof) {
+        return false;
+    }
+    if (m_nBegin > 0) {
+        memmove( m_vBuffer.data(), m_vBuffer.data() + m_nBegin, m_nEnd - m_nBegin );
+        m_nEnd  -= m_nBegin;
+        m_nBegin = 0;
+    }
+    if (m_nEnd == m_vBuffer.size()) {
+        m_vBuffer.resize( 2 * m_vBuffer.size());
+    }
+    size_t nRead = fread( m_vBuffer.data() + m_nEnd, 1, m_vBuffer.size() - m_nEnd, m_pFile );
+    if (nRead == 0) {
+        m_bEof = true;
+    }
+    m_nEnd       += nRead;
+    m_nBytesRead += nRead;
+    return nRead > 0;
+}
+
+bool flcStreamReader::NextLine( std::string_view &sLine ) {
+    while (true) {
+        const char *pBuf = m_vBuffer.data();
+        const char *pEol = (const char *)memchr( pBuf + m_nBegin, '\n', m_nEnd - m_nBegin );
+        if (pEol != nullptr || (m_bEof && m_nBegin < m_nEnd)) {
+            size_t nEnd  = (pEol == nullptr) ? m_nEnd : (size_t)(pEol - pBuf);
+            size_t nNext = (pEol == nullptr) ? m_nEnd : nEnd + 1;
+            if (nEnd > m_nBegin && pBuf[nEnd - 1] == '\r') {
+                nEnd -= 1;
+            }
+            sLine    = std::string_view( pBuf + m_nBegin, nEnd - m_nBegin );
+            m_nBegin = nNext;
+            return true;
+        }
+        if (!Fill() && m_nBegin == m_nEnd) {
+            return false;
+        }
+    }
+}
+
+bool flcStreamReader::NextChunk( std::string_view &sChunk ) {
+    if (m_nBegin == m_nEnd) {
+        m_nBegin = 0;
+        m_nEnd   = 0;
+        if (!Fill()) {
+            return false;
+        }
+    }
+    sChunk   = std::string_view( m_vBuffer.data() + m_nBegin, m_nEnd - m_nBegin );
+    m_nBegin = m_nEnd;
+    return true;
+}
@@ -0,0 +1,54 @@
+// AoC 2022 - streaming input reader
+// =================================
+
+// date:  2022-12-31
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCSTREAMREADER_H
+#define FLCSTREAMREADER_H
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Forward only reader for a file or a pipe, in one fixed size buffer. Unlike flcInputFile the
+// memory use doesn't depend on the input size, so it's meant for inputs that are too big to
+// keep (the buffer only grows for a line that is longer than the buffer itself).
+// The file name "-" means stdin. Lines come without terminator ("\n" or "\r\n"), and like getline()
+// a last line without terminator is included.
+// NOTE: a view is only valid until the next call to NextLine() or NextChunk()
+class flcStreamReader {
+public:
+    flcStreamReader( size_t nBufSize = 1 << 20 ) : m_vBuffer( nBufSize ) {}
+    flcStreamReader( const std::string &sFileName, size_t nBufSize = 1 << 20 ) : m_vBuffer( nBufSize ) { Open( sFileName ); }
+    ~flcStreamReader() { Close(); }
+
+    flcStreamReader( const flcStreamReader & ) = delete;
+    flcStreamReader &operator = ( const flcStreamReader & ) = delete;
+
+    // returns false (and reports an error) if the file can't be opened
+    bool Open( const std::string &sFileName );
+    void Close();
+    bool IsOpen() { return m_pFile != nullptr; }
+
+    // returns false if there are no more lines
+    bool NextLine( std::string_view &sLine );
+    // returns the next block of raw bytes (line terminators included), false at the end of the input
+    bool NextChunk( std::string_view &sChunk );
+
+    // nr of bytes read from the input so far
+    long long BytesRead() { return m_nBytesRead; }
+
+private:
+    bool Fill();
+
+    FILE             *m_pFile = nullptr;
+    bool              m_bStdIn = false;
+    bool              m_bEof = false;
+    std::vector<char> m_vBuffer;
+    size_t            m_nBegin = 0, m_nEnd = 0;    // the part of the buffer that is not consumed yet
+    long long         m_nBytesRead = 0;
+};
+
+#endif // FLCSTREAMREADER_H
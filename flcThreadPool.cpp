@@ -0,0 +1,72 @@
+// AoC 2022 - thread pool utility
+// ==============================
+
+// date:  2022-12-27
+// by:    Joseph21 (Joseph21-6147)
+
+#include "flcThreadPool.h"
+
+// ==============================/ Class flcThreadPool /==============================
+
+flcThreadPool::flcThreadPool( int nThreads ) {
+    if (nThreads <= 0) {
+        nThreads = (int)std::thread::hardware_concurrency();
+    }
+    if (nThreads <= 0) {    // hardware_concurrency() may return 0 if it can't tell
+        nThreads = 1;
+    }
+    for (int i = 0; i < nThreads; i++) {
+        m_workers.push_back( std::thread( &flcThreadPool::WorkerLoop, this ));
+    }
+}
+
+flcThreadPool::~flcThreadPool() {
+    WaitAll();
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_bStop = true;
+    }
+    m_cvTask.notify_all();
+    for (auto &t : m_workers) {
+        t.join();
+    }
+}
+
+void flcThreadPool::AddTask( std::function<void()> fTask ) {
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_tasks.push( fTask );
+    }
+    m_cvTask.notify_one();
+}
+
+void flcThreadPool::WaitAll() {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_cvDone.wait( lock, [this]() { return m_tasks.empty() && m_nActive == 0; } );
+}
+
+// Each worker picks tasks from the queue until the pool is stopped. A task that is running
+// is counted in m_nActive, so that WaitAll() doesn't return while it can still add new tasks.
+void flcThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> fTask;
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_cvTask.wait( lock, [this]() { return m_bStop || !m_tasks.empty(); } );
+            if (m_bStop && m_tasks.empty()) {
+                return;
+            }
+            fTask = m_tasks.front();
+            m_tasks.pop();
+            m_nActive += 1;
+        }
+
+        fTask();
+
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_nActive -= 1;
+        }
+        m_cvDone.notify_all();
+    }
+}
@@ -0,0 +1,44 @@
+// AoC 2022 - thread pool utility
+// ==============================
+
+// date:  2022-12-27
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCTHREADPOOL_H
+#define FLCTHREADPOOL_H
+
+#include <vector>
+#include <queue>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// A fixed size pool of worker threads that execute tasks from one shared queue.
+// Tasks may add new tasks to the pool (e.g. to start part 2 after part 1 is done).
+class flcThreadPool {
+public:
+    // nThreads <= 0 means: use the nr of hardware threads
+    flcThreadPool( int nThreads = 0 );
+    // waits until all tasks are done, then stops the workers
+    ~flcThreadPool();
+
+    void AddTask( std::function<void()> fTask );
+    // blocks until the queue is empty and no task is running anymore
+    void WaitAll();
+
+    int NrThreads() { return (int)m_workers.size(); }
+
+private:
+    void WorkerLoop();
+
+    std::vector<std::thread>          m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex                        m_mutex;
+    std::condition_variable           m_cvTask;      // signals workers that a task is available (or stop is set)
+    std::condition_variable           m_cvDone;      // signals WaitAll() that a task finished
+    int                               m_nActive = 0; // nr of tasks that are currently running
+    bool                              m_bStop = false;
+};
+
+#endif // FLCTHREADPOOL_H
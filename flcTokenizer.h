@@ -0,0 +1,86 @@
+// AoC 2022 - zero copy tokenizer
+// ==============================
+
+// date:  2022-12-31
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCTOKENIZER_H
+#define FLCTOKENIZER_H
+
+#include <string_view>
+#include <charconv>
+#include <algorithm>
+
+// Parses the integer at the start of sv (leading spaces are skipped). Returns 0 if sv doesn't
+// start with a number. Uses std::from_chars, so no locale and no copy of the input
+template <class T>
+T flcToNumber( std::string_view sv ) {
+    T nValue = T( 0 );
+    size_t nStart = std::min( sv.find_first_not_of( ' ' ), sv.length());
+    std::from_chars( sv.data() + nStart, sv.data() + sv.length(), nValue );
+    return nValue;
+}
+
+// A cursor over a string (or a line of an flcInputFile). Each Next...() call cuts a token off
+// the front of the remaining input. The tokens are string_views into the input, so nothing is
+// copied and tokenizing a line is linear in its length.
+// NOTE: the tokenizer and its tokens are only valid as long as the input they view is alive.
+class flcTokenizer {
+public:
+    flcTokenizer( std::string_view sInput = std::string_view() ) : m_sRest( sInput ) {}
+
+    bool             Empty() const { return m_sRest.empty(); }
+    // the part of the input that is not tokenized yet
+    std::string_view Rest()  const { return m_sRest; }
+    // the next character, or '\0' if the input is exhausted
+    char             Peek()  const { return m_sRest.empty() ? '\0' : m_sRest[0]; }
+
+    // Returns the front token up to sDelim and skips the delimiter. If sDelim is not found, the
+    // complete remaining input is the token (and the tokenizer becomes empty).
+    std::string_view NextDelimited( std::string_view sDelim ) {
+        size_t nSplit = m_sRest.find( sDelim );
+        std::string_view sToken = m_sRest.substr( 0, nSplit );
+        m_sRest.remove_prefix( (nSplit == std::string_view::npos) ? m_sRest.length() : nSplit + sDelim.length());
+        return sToken;
+    }
+
+    // Returns the front token of (at most) nSize characters
+    std::string_view NextSized( size_t nSize ) {
+        std::string_view sToken = m_sRest.substr( 0, nSize );
+        m_sRest.remove_prefix( sToken.length());
+        return sToken;
+    }
+
+    void Skip( size_t nSize ) { m_sRest.remove_prefix( std::min( nSize, m_sRest.length())); }
+
+    // skips sPrefix if the remaining input starts with it, and returns whether it did
+    bool SkipPrefix( std::string_view sPrefix ) {
+        bool bMatch = (m_sRest.substr( 0, sPrefix.length()) == sPrefix);
+        if (bMatch) {
+            m_sRest.remove_prefix( sPrefix.length());
+        }
+        return bMatch;
+    }
+
+    // Without sDelim: parses the number at the front (leading spaces are skipped) and only cuts
+    // off that number - it's 0 and nothing is cut off if there's no number.
+    // With sDelim: cuts off the token up to sDelim (see NextDelimited()) and returns its number value.
+    template <class T>
+    T NextNumber( std::string_view sDelim = std::string_view() ) {
+        if (!sDelim.empty()) {
+            return flcToNumber<T>( NextDelimited( sDelim ));
+        }
+        T nValue = T( 0 );
+        size_t nStart = std::min( m_sRest.find_first_not_of( ' ' ), m_sRest.length());
+        const char *pEnd = std::from_chars( m_sRest.data() + nStart, m_sRest.data() + m_sRest.length(), nValue ).ptr;
+        if (pEnd != m_sRest.data() + nStart) {
+            m_sRest.remove_prefix( pEnd - m_sRest.data());
+        }
+        return nValue;
+    }
+
+private:
+    std::string_view m_sRest;
+};
+
+#endif // FLCTOKENIZER_H
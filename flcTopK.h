@@ -0,0 +1,72 @@
+// AoC 2022 - bounded top-k selection
+// ==================================
+
+// date:  2023-01-10
+// by:    Joseph21 (Joseph21-6147)
+
+#ifndef FLCTOPK_H
+#define FLCTOPK_H
+
+#include <vector>
+#include <functional>    // std::less
+#include <algorithm>
+
+// Keeps the k largest of the values that are added to it (according to Compare, which orders like
+// std::less - pass std::greater to keep the k smallest). The values are kept in a heap of at most
+// k elements with the smallest kept value on top, so adding a value is O(log k), and finding the
+// top k of n values is O(n log k) in one pass, instead of O(n log n) for sorting all of them.
+template <class T, class Compare = std::less<T>>
+class flcTopK {
+public:
+    flcTopK( size_t k, Compare comp = Compare()) : m_nK( k ), m_comp( comp ) { m_vHeap.reserve( k ); }
+
+    void Add( const T &t ) {
+        if (m_vHeap.size() < m_nK) {
+            m_vHeap.push_back( t );
+            std::push_heap( m_vHeap.begin(), m_vHeap.end(), HeapOrder());
+        } else if (m_nK > 0 && m_comp( m_vHeap.front(), t )) {
+            // t beats the smallest kept value, which is dropped
+            std::pop_heap( m_vHeap.begin(), m_vHeap.end(), HeapOrder());
+            m_vHeap.back() = t;
+            std::push_heap( m_vHeap.begin(), m_vHeap.end(), HeapOrder());
+        }
+    }
+    // adds all values in [first, last)
+    template <class It>
+    void Add( It first, It last ) {
+        for (; first != last; ++first) {
+            Add( *first );
+        }
+    }
+
+    size_t K()     const { return m_nK; }
+    size_t Size()  const { return m_vHeap.size(); }    // less than k as long as fewer than k values were added
+    bool   Empty() const { return m_vHeap.empty(); }
+    void   Clear()       { m_vHeap.clear(); }
+
+    // the smallest of the kept values - the value that a new one must beat to get in
+    // NOTE: only valid if not Empty()
+    const T &Threshold() const { return m_vHeap.front(); }
+
+    // the kept values, largest first
+    std::vector<T> Sorted() const {
+        std::vector<T> vResult = m_vHeap;
+        std::sort_heap( vResult.begin(), vResult.end(), HeapOrder());
+        return vResult;
+    }
+
+private:
+    // the heap functions put the largest element (in their order) on top, so to get the smallest
+    // kept value on top the comparison is reversed
+    typedef struct sHeapOrder {
+        const Compare *pComp;
+        bool operator () ( const T &a, const T &b ) const { return (*pComp)( b, a ); }
+    } HeapOrderType;
+    HeapOrderType HeapOrder() const { return { &m_comp }; }
+
+    size_t         m_nK;
+    Compare        m_comp;
+    std::vector<T> m_vHeap;
+};
+
+#endif // FLCTOPK_H
@@ -0,0 +1,418 @@
+#ifndef INCLUDE_VECTOR_TYPES_SOA
+#define INCLUDE_VECTOR_TYPES_SOA
+
+/*  Feel Like Coding (FLC) License
+    ==============================
+    - This software is Copyright (C) 2023 Joseph21
+    - This is free software. This software comes with absolutely no warranty. The copyright holder is not liable
+      or responsible for anything this software does or does not. You use this software at your own risk.
+    - You can distribute this software, you can modify this software. Redistribution of this software or a
+      derivative of this software must attribute the Copyright holder named above, in a manner visible to the end user
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * Structure of arrays (SoA) companions of the 2d and 3d vector types in vector_types.h. Where a vector<vi2d>
+ * stores x, y, x, y, ... a vi2d_soa stores all x values in one array and all y values in another one. That
+ * way a bulk operation over thousands of coordinates works on whole SIMD registers at a time.
+ *
+ * The types are
+ *   1. v2d_soa - with arrays x and y, typedefs vi2d_soa and vllong2d_soa (and vf2d_soa, vd2d_soa)
+ *   2. v3d_soa - with arrays x, y and z, typedefs vi3d_soa and vllong3d_soa (and vf3d_soa, vd3d_soa)
+ *
+ * For each of these types the following functionality is implemented:
+ *   * conversion from and to a vector of the AoS type (FromAoS(), ToAoS()), push_back() and indexing
+ *   * bulk add / subtract of one vector to all elements (offset), and element wise add of another SoA
+ *   * find() / contains() of a vector (compares all components)
+ *   * component wise min(), max() and bounding_box()
+ *
+ * The bulk operations on int and long long components use SIMD: AVX2 if the compiler targets it (like
+ * with -mavx2 or -march=native), otherwise SSE2 (always there on x86-64), and plain loops on other
+ * platforms or if FLC_SOA_NO_SIMD is defined. Other component types use the plain loops.
+ * NOTE: with SSE2 only, min / max on long long components use the plain loops (there's no 64 bit compare)
+ */
+
+#include <vector>
+#include <cstddef>
+
+#include "vector_types.h"
+
+#if !defined( FLC_SOA_NO_SIMD )
+    #if defined( __AVX2__ )
+        #define FLC_SOA_AVX2
+        #include <immintrin.h>
+    #elif defined( __SSE2__ ) || defined( _M_X64 )
+        #define FLC_SOA_SSE2
+        #include <emmintrin.h>
+    #endif
+#endif
+
+//                               +----------------------+                           //
+// ------------------------------+  bulk kernel section  +-------------------------- //
+//                               +----------------------+                           //
+
+// the generic versions - the compiler may or may not vectorize these loops by itself
+template <class T> inline void soa_offset( T *p, std::size_t n, T d )        { for (std::size_t i = 0; i < n; i++) p[i] += d;    }
+template <class T> inline void soa_add(    T *p, const T *q, std::size_t n ) { for (std::size_t i = 0; i < n; i++) p[i] += q[i]; }
+template <class T> inline void soa_minmax( const T *p, std::size_t n, T &lo, T &hi ) {
+    for (std::size_t i = 0; i < n; i++) {
+        if (p[i] < lo) lo = p[i];
+        if (p[i] > hi) hi = p[i];
+    }
+}
+// returns the first index i where cols[c][i] == vals[c] for all nCols columns, -1 if there's no such index
+template <class T> inline long long soa_find( const T *const *cols, const T *vals, int nCols, std::size_t n, std::size_t nFrom = 0 ) {
+    for (std::size_t i = nFrom; i < n; i++) {
+        bool bMatch = true;
+        for (int c = 0; c < nCols && bMatch; c++) {
+            bMatch = (cols[c][i] == vals[c]);
+        }
+        if (bMatch) return (long long)i;
+    }
+    return -1;
+}
+
+// index of the lowest set bit in a (non zero) SIMD compare mask
+inline int soa_first_bit( int nMask ) { int n = 0; while ((nMask & 1) == 0) { nMask >>= 1; n++; } return n; }
+
+#if defined( FLC_SOA_AVX2 )
+
+inline void soa_offset( int *p, std::size_t n, int d ) {
+    std::size_t i = 0;
+    __m256i vd = _mm256_set1_epi32( d );
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(p + i));
+        _mm256_storeu_si256( (__m256i *)(p + i), _mm256_add_epi32( v, vd ));
+    }
+    soa_offset<int>( p + i, n - i, d );
+}
+inline void soa_offset( long long *p, std::size_t n, long long d ) {
+    std::size_t i = 0;
+    __m256i vd = _mm256_set1_epi64x( d );
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(p + i));
+        _mm256_storeu_si256( (__m256i *)(p + i), _mm256_add_epi64( v, vd ));
+    }
+    soa_offset<long long>( p + i, n - i, d );
+}
+inline void soa_add( int *p, const int *q, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(p + i));
+        __m256i w = _mm256_loadu_si256( (const __m256i *)(q + i));
+        _mm256_storeu_si256( (__m256i *)(p + i), _mm256_add_epi32( v, w ));
+    }
+    soa_add<int>( p + i, q + i, n - i );
+}
+inline void soa_add( long long *p, const long long *q, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(p + i));
+        __m256i w = _mm256_loadu_si256( (const __m256i *)(q + i));
+        _mm256_storeu_si256( (__m256i *)(p + i), _mm256_add_epi64( v, w ));
+    }
+    soa_add<long long>( p + i, q + i, n - i );
+}
+inline void soa_minmax( const int *p, std::size_t n, int &lo, int &hi ) {
+    std::size_t i = 0;
+    if (n >= 8) {
+        __m256i vlo = _mm256_set1_epi32( lo ), vhi = _mm256_set1_epi32( hi );
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256( (const __m256i *)(p + i));
+            vlo = _mm256_min_epi32( vlo, v );
+            vhi = _mm256_max_epi32( vhi, v );
+        }
+        alignas( 32 ) int aLo[8], aHi[8];
+        _mm256_store_si256( (__m256i *)aLo, vlo );
+        _mm256_store_si256( (__m256i *)aHi, vhi );
+        soa_minmax<int>( aLo, 8, lo, hi );
+        soa_minmax<int>( aHi, 8, lo, hi );
+    }
+    soa_minmax<int>( p + i, n - i, lo, hi );
+}
+inline void soa_minmax( const long long *p, std::size_t n, long long &lo, long long &hi ) {
+    std::size_t i = 0;
+    if (n >= 4) {
+        __m256i vlo = _mm256_set1_epi64x( lo ), vhi = _mm256_set1_epi64x( hi );
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_loadu_si256( (const __m256i *)(p + i));
+            vlo = _mm256_blendv_epi8( vlo, v, _mm256_cmpgt_epi64( vlo, v ));
+            vhi = _mm256_blendv_epi8( vhi, v, _mm256_cmpgt_epi64( v, vhi ));
+        }
+        alignas( 32 ) long long aLo[4], aHi[4];
+        _mm256_store_si256( (__m256i *)aLo, vlo );
+        _mm256_store_si256( (__m256i *)aHi, vhi );
+        soa_minmax<long long>( aLo, 4, lo, hi );
+        soa_minmax<long long>( aHi, 4, lo, hi );
+    }
+    soa_minmax<long long>( p + i, n - i, lo, hi );
+}
+inline long long soa_find( const int *const *cols, const int *vals, int nCols, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vEq = _mm256_set1_epi32( -1 );
+        for (int c = 0; c < nCols; c++) {
+            __m256i v = _mm256_loadu_si256( (const __m256i *)(cols[c] + i));
+            vEq = _mm256_and_si256( vEq, _mm256_cmpeq_epi32( v, _mm256_set1_epi32( vals[c] )));
+        }
+        int nMask = _mm256_movemask_ps( _mm256_castsi256_ps( vEq ));
+        if (nMask != 0) return (long long)(i + soa_first_bit( nMask ));
+    }
+    return soa_find<int>( cols, vals, nCols, n, i );
+}
+inline long long soa_find( const long long *const *cols, const long long *vals, int nCols, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i vEq = _mm256_set1_epi64x( -1 );
+        for (int c = 0; c < nCols; c++) {
+            __m256i v = _mm256_loadu_si256( (const __m256i *)(cols[c] + i));
+            vEq = _mm256_and_si256( vEq, _mm256_cmpeq_epi64( v, _mm256_set1_epi64x( vals[c] )));
+        }
+        int nMask = _mm256_movemask_pd( _mm256_castsi256_pd( vEq ));
+        if (nMask != 0) return (long long)(i + soa_first_bit( nMask ));
+    }
+    return soa_find<long long>( cols, vals, nCols, n, i );
+}
+
+#elif defined( FLC_SOA_SSE2 )
+
+inline void soa_offset( int *p, std::size_t n, int d ) {
+    std::size_t i = 0;
+    __m128i vd = _mm_set1_epi32( d );
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(p + i));
+        _mm_storeu_si128( (__m128i *)(p + i), _mm_add_epi32( v, vd ));
+    }
+    soa_offset<int>( p + i, n - i, d );
+}
+inline void soa_offset( long long *p, std::size_t n, long long d ) {
+    std::size_t i = 0;
+    __m128i vd = _mm_set1_epi64x( d );
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(p + i));
+        _mm_storeu_si128( (__m128i *)(p + i), _mm_add_epi64( v, vd ));
+    }
+    soa_offset<long long>( p + i, n - i, d );
+}
+inline void soa_add( int *p, const int *q, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(p + i));
+        __m128i w = _mm_loadu_si128( (const __m128i *)(q + i));
+        _mm_storeu_si128( (__m128i *)(p + i), _mm_add_epi32( v, w ));
+    }
+    soa_add<int>( p + i, q + i, n - i );
+}
+inline void soa_add( long long *p, const long long *q, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(p + i));
+        __m128i w = _mm_loadu_si128( (const __m128i *)(q + i));
+        _mm_storeu_si128( (__m128i *)(p + i), _mm_add_epi64( v, w ));
+    }
+    soa_add<long long>( p + i, q + i, n - i );
+}
+// SSE2 has no min / max for 32 bit ints, so they are made with a compare and a select
+inline void soa_minmax( const int *p, std::size_t n, int &lo, int &hi ) {
+    std::size_t i = 0;
+    if (n >= 4) {
+        __m128i vlo = _mm_set1_epi32( lo ), vhi = _mm_set1_epi32( hi );
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128( (const __m128i *)(p + i));
+            __m128i gtLo = _mm_cmpgt_epi32( vlo, v );
+            __m128i gtHi = _mm_cmpgt_epi32( v, vhi );
+            vlo = _mm_or_si128( _mm_and_si128( gtLo, v ), _mm_andnot_si128( gtLo, vlo ));
+            vhi = _mm_or_si128( _mm_and_si128( gtHi, v ), _mm_andnot_si128( gtHi, vhi ));
+        }
+        alignas( 16 ) int aLo[4], aHi[4];
+        _mm_store_si128( (__m128i *)aLo, vlo );
+        _mm_store_si128( (__m128i *)aHi, vhi );
+        soa_minmax<int>( aLo, 4, lo, hi );
+        soa_minmax<int>( aHi, 4, lo, hi );
+    }
+    soa_minmax<int>( p + i, n - i, lo, hi );
+}
+inline long long soa_find( const int *const *cols, const int *vals, int nCols, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i vEq = _mm_set1_epi32( -1 );
+        for (int c = 0; c < nCols; c++) {
+            __m128i v = _mm_loadu_si128( (const __m128i *)(cols[c] + i));
+            vEq = _mm_and_si128( vEq, _mm_cmpeq_epi32( v, _mm_set1_epi32( vals[c] )));
+        }
+        int nMask = _mm_movemask_ps( _mm_castsi128_ps( vEq ));
+        if (nMask != 0) return (long long)(i + soa_first_bit( nMask ));
+    }
+    return soa_find<int>( cols, vals, nCols, n, i );
+}
+// SSE2 has no 64 bit compare: two 64 bit values are equal if both their 32 bit halves are equal
+inline long long soa_find( const long long *const *cols, const long long *vals, int nCols, std::size_t n ) {
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i vEq = _mm_set1_epi32( -1 );
+        for (int c = 0; c < nCols; c++) {
+            __m128i v    = _mm_loadu_si128( (const __m128i *)(cols[c] + i));
+            __m128i eq32 = _mm_cmpeq_epi32( v, _mm_set1_epi64x( vals[c] ));
+            vEq = _mm_and_si128( vEq, _mm_and_si128( eq32, _mm_shuffle_epi32( eq32, _MM_SHUFFLE( 2, 3, 0, 1 ))));
+        }
+        int nMask = _mm_movemask_pd( _mm_castsi128_pd( vEq ));
+        if (nMask != 0) return (long long)(i + soa_first_bit( nMask ));
+    }
+    return soa_find<long long>( cols, vals, nCols, n, i );
+}
+
+#endif
+
+//                               +---------------------------------------+                           //
+// ------------------------------+  2 d structure of arrays definitions  +-------------------------- //
+//                               +---------------------------------------+                           //
+
+template <class T>
+struct v2d_soa {
+
+    // variables section ====================================================
+    std::vector<T> x, y;
+
+    // constructor section ====================================================
+    v2d_soa() {}                                                                    // default constructor
+    v2d_soa( const std::vector<v2d_generic<T>> &vAoS ) { FromAoS( vAoS ); }         // conversion constructor
+
+    // container functions ====================================================
+    std::size_t size() const  { return x.size();  }
+    bool        empty() const { return x.empty(); }
+    void clear()                                     { x.clear(); y.clear(); }
+    void reserve( std::size_t n )                    { x.reserve( n ); y.reserve( n ); }
+    void push_back( const v2d_generic<T> &v )        { x.push_back( v.x ); y.push_back( v.y ); }
+    void set( std::size_t i, const v2d_generic<T> &v ) { x[i] = v.x; y[i] = v.y; }
+    // NOTE: returns a copy - use set() to change an element
+    v2d_generic<T> operator [] ( std::size_t i ) const { return v2d_generic<T>( x[i], y[i] ); }
+
+    // conversion from and to array of structs ================================
+    void FromAoS( const std::vector<v2d_generic<T>> &vAoS ) {
+        clear();
+        reserve( vAoS.size());
+        for (auto &v : vAoS) push_back( v );
+    }
+    void ToAoS( std::vector<v2d_generic<T>> &vAoS ) const {
+        vAoS.resize( size());
+        for (std::size_t i = 0; i < size(); i++) vAoS[i] = (*this)[i];
+    }
+
+    // bulk operations ========================================================
+    // add (subtract) d to all elements
+    v2d_soa &operator += ( const v2d_generic<T> &d ) { soa_offset( x.data(), size(), d.x ); soa_offset( y.data(), size(), d.y ); return *this; }
+    v2d_soa &operator -= ( const v2d_generic<T> &d ) { return *this += v2d_generic<T>( -d.x, -d.y ); }
+    // element wise add - NOTE: programmer must guarantee that rhs has (at least) the same size!! (no error checking)
+    v2d_soa &operator += ( const v2d_soa &rhs ) { soa_add( x.data(), rhs.x.data(), size()); soa_add( y.data(), rhs.y.data(), size()); return *this; }
+
+    // returns the index of the first element that is equal to v, -1 if there's none
+    long long find( const v2d_generic<T> &v ) const {
+        const T *cols[2] = { x.data(), y.data() };
+        const T  vals[2] = { v.x, v.y };
+        return soa_find( cols, vals, 2, size());
+    }
+    bool contains( const v2d_generic<T> &v ) const { return find( v ) != -1; }
+
+    // component wise min and max of all elements - returns false (and leaves lo and hi alone) if empty
+    bool bounding_box( v2d_generic<T> &lo, v2d_generic<T> &hi ) const {
+        if (empty()) return false;
+        lo = hi = (*this)[0];
+        soa_minmax( x.data(), size(), lo.x, hi.x );
+        soa_minmax( y.data(), size(), lo.y, hi.y );
+        return true;
+    }
+    // NOTE: programmer must guarantee that the SoA is not empty!! (no error checking)
+    v2d_generic<T> min() const { v2d_generic<T> lo, hi; bounding_box( lo, hi ); return lo; }
+    v2d_generic<T> max() const { v2d_generic<T> lo, hi; bounding_box( lo, hi ); return hi; }
+};
+
+// create convenient shorthand types, using typedef
+typedef v2d_soa<int      > vi2d_soa;
+typedef v2d_soa<float    > vf2d_soa;
+typedef v2d_soa<double   > vd2d_soa;
+typedef v2d_soa<long long> vllong2d_soa;
+
+//                               +---------------------------------------+                           //
+// ------------------------------+  3 d structure of arrays definitions  +-------------------------- //
+//                               +---------------------------------------+                           //
+
+template <class T>
+struct v3d_soa {
+
+    // variables section ====================================================
+    std::vector<T> x, y, z;
+
+    // constructor section ====================================================
+    v3d_soa() {}                                                                    // default constructor
+    v3d_soa( const std::vector<v3d_generic<T>> &vAoS ) { FromAoS( vAoS ); }         // conversion constructor
+
+    // container functions ====================================================
+    std::size_t size() const  { return x.size();  }
+    bool        empty() const { return x.empty(); }
+    void clear()                                     { x.clear(); y.clear(); z.clear(); }
+    void reserve( std::size_t n )                    { x.reserve( n ); y.reserve( n ); z.reserve( n ); }
+    void push_back( const v3d_generic<T> &v )        { x.push_back( v.x ); y.push_back( v.y ); z.push_back( v.z ); }
+    void set( std::size_t i, const v3d_generic<T> &v ) { x[i] = v.x; y[i] = v.y; z[i] = v.z; }
+    // NOTE: returns a copy - use set() to change an element
+    v3d_generic<T> operator [] ( std::size_t i ) const { return v3d_generic<T>( x[i], y[i], z[i] ); }
+
+    // conversion from and to array of structs ================================
+    void FromAoS( const std::vector<v3d_generic<T>> &vAoS ) {
+        clear();
+        reserve( vAoS.size());
+        for (auto &v : vAoS) push_back( v );
+    }
+    void ToAoS( std::vector<v3d_generic<T>> &vAoS ) const {
+        vAoS.resize( size());
+        for (std::size_t i = 0; i < size(); i++) vAoS[i] = (*this)[i];
+    }
+
+    // bulk operations ========================================================
+    // add (subtract) d to all elements
+    v3d_soa &operator += ( const v3d_generic<T> &d ) {
+        soa_offset( x.data(), size(), d.x ); soa_offset( y.data(), size(), d.y ); soa_offset( z.data(), size(), d.z );
+        return *this;
+    }
+    v3d_soa &operator -= ( const v3d_generic<T> &d ) { return *this += v3d_generic<T>( -d.x, -d.y, -d.z ); }
+    // element wise add - NOTE: programmer must guarantee that rhs has (at least) the same size!! (no error checking)
+    v3d_soa &operator += ( const v3d_soa &rhs ) {
+        soa_add( x.data(), rhs.x.data(), size()); soa_add( y.data(), rhs.y.data(), size()); soa_add( z.data(), rhs.z.data(), size());
+        return *this;
+    }
+
+    // returns the index of the first element that is equal to v, -1 if there's none
+    long long find( const v3d_generic<T> &v ) const {
+        const T *cols[3] = { x.data(), y.data(), z.data() };
+        const T  vals[3] = { v.x, v.y, v.z };
+        return soa_find( cols, vals, 3, size());
+    }
+    bool contains( const v3d_generic<T> &v ) const { return find( v ) != -1; }
+
+    // component wise min and max of all elements - returns false (and leaves lo and hi alone) if empty
+    bool bounding_box( v3d_generic<T> &lo, v3d_generic<T> &hi ) const {
+        if (empty()) return false;
+        lo = hi = (*this)[0];
+        soa_minmax( x.data(), size(), lo.x, hi.x );
+        soa_minmax( y.data(), size(), lo.y, hi.y );
+        soa_minmax( z.data(), size(), lo.z, hi.z );
+        return true;
+    }
+    // NOTE: programmer must guarantee that the SoA is not empty!! (no error checking)
+    v3d_generic<T> min() const { v3d_generic<T> lo, hi; bounding_box( lo, hi ); return lo; }
+    v3d_generic<T> max() const { v3d_generic<T> lo, hi; bounding_box( lo, hi ); return hi; }
+};
+
+// create convenient shorthand types, using typedef
+typedef v3d_soa<int      > vi3d_soa;
+typedef v3d_soa<float    > vf3d_soa;
+typedef v3d_soa<double   > vd3d_soa;
+typedef v3d_soa<long long> vllong3d_soa;
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // INCLUDE_VECTOR_TYPES_SOA